@@ -153,7 +153,11 @@ typedef int8_t    pin_t;
 #include "src/core/heater/sensor/thermistor.h"
 #include "src/core/heater/heater.h"
 #include "src/core/temperature/temperature.h"
+#include "src/core/temperature/thermallog.h"
+#include "src/core/temperature/standby.h"
+#include "src/core/tools/switchtest.h"
 #include "src/core/printcounter/printcounter.h"
+#include "src/core/scheduler/scheduler.h"
 
 // LCD modules
 #include "src/lcd/language/language.h"
@@ -181,6 +185,7 @@ typedef int8_t    pin_t;
 
 // SD modules
 #include "src/sd/cardreader.h"
+#include "src/sd/filetransfer.h"
 
 // Utility modules
 #include "src/utility/utility.h"
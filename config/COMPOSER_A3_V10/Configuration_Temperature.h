@@ -31,12 +31,16 @@
  * - Automatic temperature
  * - Temperature status LEDs
  * - PWM Heater Speed
+ * - PWM Heater Resolution
+ * - Parallel heat-up
  * - PID Settings - HOTEND
  * - PID Settings - BED
  * - PID Settings - CHAMBER
  * - PID Settings - COOLER
  * - Inverted PINS
  * - Thermal runaway protection
+ * - Thermal log
+ * - Hotend standby
  * - Prevent cold extrusion
  *
  */
@@ -94,6 +98,26 @@
 // Thermistor series resistor value in Ohms (see on your board)
 #define THERMISTOR_SERIES_RS 4700.0
 
+// Thermistors (types 1-9) are read from a table of THERMISTOR_TABLE_SIZE steps over the ADC range,
+// built from the sensor parameters at boot and by M305, instead of computing a logarithm per reading.
+// Costs 2 bytes * (THERMISTOR_TABLE_SIZE + 1) per heater. Comment out to use the formula.
+#define THERMISTOR_TABLE_SIZE 512   // Power of 2 (32-1024)
+
+// ADC pipeline (Arduino Due only). Each channel gives a sample every RATE ms: the conversions
+// of the last ms are summed (oversampling), then filtered by the median of the last 3 samples
+// and by a moving average of AVERAGE samples. Slow sensors keep their channel off between
+// samples, leaving the conversions to the hotends.
+#define ADC_HOTEND_RATE       1   // (ms) 1-255
+#define ADC_HOTEND_AVERAGE    8   // Power of 2 (1-32)
+#define ADC_BED_RATE         10   // (ms) 1-255
+#define ADC_BED_AVERAGE       8   // Power of 2 (1-32)
+#define ADC_CHAMBER_RATE     20   // (ms) 1-255, chamber and cooler
+#define ADC_CHAMBER_AVERAGE   8   // Power of 2 (1-32)
+#define ADC_AUX_RATE        100   // (ms) 1-255, filament width, power consumption and MCU temperature
+#define ADC_AUX_AVERAGE       4   // Power of 2 (1-32)
+// Drop single spikes with the median, costs a sample of delay. Comment out to disable.
+#define ADC_MEDIAN_FILTER
+
 // User Sensor
 #define T9_NAME   "NCP21WF104J03RA"
 #define T9_R25    100000.0  // Resistance in Ohms @ 25C
@@ -220,6 +244,50 @@
 /***********************************************************************/
 
 
+/***********************************************************************
+ ********************** PWM Heater Resolution **************************
+ ***********************************************************************
+ *                                                                     *
+ * Bits of the heater duty, from the PID to the PWM or timer channel   *
+ * (8-16, over 8 only for Arduino Due). With 8 the duty has 256 steps, *
+ * too coarse for a hotend that holds its temperature with a few       *
+ * percent. The Due channels have at least 15 bits at heater rates.    *
+ *                                                                     *
+ * HEATER PWM DITHER switches every ms the heaters on pins without     *
+ * PWM or timer, so that on average they get the requested duty.       *
+ *                                                                     *
+ ***********************************************************************/
+#define HEATER_PWM_RESOLUTION 12
+//#define HEATER_PWM_DITHER
+/***********************************************************************/
+
+
+/***********************************************************************
+ ************************* Parallel heat-up ****************************
+ ***********************************************************************
+ *                                                                     *
+ * When M109, M190, M191 or M116 start to wait, the temperature        *
+ * commands queued right after them (M104, M109, M140, M190, M141,     *
+ * M191) set their targets at once, so all the heaters warm up         *
+ * together. M116 waits until every heater has reached its target.     *
+ *                                                                     *
+ * HEATER_POWER_BUDGET limits the power of all the heaters together,   *
+ * to heat the bed and the hotends at the same time without            *
+ * overloading the power supply. When the heaters ask for more, the    *
+ * PWM of each one is scaled by the same factor.                       *
+ * Set the power of each heater at full PWM.                           *
+ *                                                                     *
+ ***********************************************************************/
+//#define PARALLEL_HEATUP
+
+//#define HEATER_POWER_BUDGET 300             // (W)
+#define HOTEND_POWER        { 40, 40, 40, 40 } // (W)
+#define BED_POWER           250             // (W)
+#define CHAMBER_POWER         0             // (W)
+#define COOLER_POWER          0             // (W)
+/***********************************************************************/
+
+
 /***********************************************************************
  ********************** PID Settings - HOTEND **************************
  ***********************************************************************
@@ -251,6 +319,14 @@
 #define DEFAULT_Ki {0.52, 0.63, 07, 07}     // Ki for H0, H1, H2, H3
 #define DEFAULT_Kd {22.62, 35.408, 60, 60}     // Kd for H0, H1, H2, H3
 #define DEFAULT_Kc {100, 100, 100, 100} // heating power = Kc * (e_speed)
+
+// Feed-forward on the hotends, added to the PID output: Kl * (target - 25) + Kf * flow.
+// The flow (mm3/s) is the average over the next PID_FEEDFORWARD_TIME ms of the moves in the
+// planner, from the plastic drivers of the hotend, so the power rises before the plastic does.
+// M303 fits Kl, the heat lost per degree. For Kf about 0.56 * (target - 25) / heater watts.
+//#define PID_FEEDFORWARD
+#define PID_FEEDFORWARD_TIME 2000           // (ms)
+#define DEFAULT_Kf {3.0, 3.0, 3.0, 3.0}     // heating power = Kf * (mm3/s)
 /***********************************************************************/
 /***********************************************************************/
 
@@ -432,6 +508,44 @@
 /********************************************************************************/
 
 
+/********************************************************************************
+ ******************************* Thermal log ************************************
+ ********************************************************************************
+ *                                                                              *
+ * Keep in RAM the last THERMAL_LOG_SIZE samples of every heater: temperature,  *
+ * target, PWM and raw ADC value. A sample is taken every THERMAL_LOG_INTERVAL  *
+ * temperature cycles (100ms each), each one with its real distance in ms. The  *
+ * log stops on the first heater error, thermal runaway included, so the        *
+ * moments before the fault can be read back with M156.                         *
+ * RAM used: THERMAL_LOG_SIZE * (2 + 8 bytes for each heater).                  *
+ *                                                                              *
+ ********************************************************************************/
+//#define THERMAL_LOG
+#define THERMAL_LOG_SIZE      300     // Samples for each heater
+#define THERMAL_LOG_INTERVAL    1     // Temperature cycles (100ms) between samples, 1-255
+/********************************************************************************/
+
+
+/********************************************************************************
+ ******************************* Hotend standby *********************************
+ ********************************************************************************
+ *                                                                              *
+ * While printing, a hotend left by a tool change drops to HOTEND_STANDBY_TEMP  *
+ * when its next use is far enough, and heats up again just in time.            *
+ * The next use is forecast from the time the hotend stayed unused the last     *
+ * times, and from the T and M1001 (fiber hotend) commands already queued.      *
+ * The heat up rate of every hotend is measured when it comes back from         *
+ * standby. Any new target set by a command takes the hotend out of standby.    *
+ *                                                                              *
+ ********************************************************************************/
+//#define HOTEND_STANDBY
+#define HOTEND_STANDBY_TEMP         150   // Standby temperature (C)
+#define HOTEND_STANDBY_DELAY         30   // Seconds unused before the first standby of a hotend
+#define HOTEND_STANDBY_LEAD          10   // Seconds at temperature before the hotend is used
+#define HOTEND_STANDBY_HEATUP_RATE  2.0   // First guess of the heat up rate (C/s)
+/********************************************************************************/
+
+
 /***********************************************************************
  ************************ Prevent cold extrusion ***********************
  ***********************************************************************
@@ -214,6 +214,11 @@
 //Change moves
 #define CHANGE_MOVES 12
 
+//Travel limits of the switch path moves (X, Y), switch offsets M217 A B included.
+//M217 refuses the moves out of them, an EEPROM path out of them is replaced by the one below
+#define CHANGE_MOVES_MIN_POS {X_MIN_POS, -5.0}
+#define CHANGE_MOVES_MAX_POS {341.0, Y_MAX_POS}
+
 
 
 
@@ -250,6 +255,14 @@
 #define CUT_SERVO_ID      0
 #define CUT_ACTIVE_ANGLE  30
 #define CUT_NEUTRAL_ANGLE 90
+#define CUT_DWELL_TIME    300 // ms the blade stays closed before the next move
+
+//Tool switch endurance test (M1012)
+#define SWITCH_TEST
+#define SWITCH_TEST_LOG_SIZE 100  // Last switches kept in RAM, 10 bytes each with two hotends
+
+//Extrusion and spool accounting (M1014)
+#define PLASTIC_DENSITY 1.24  // g/cm3, turns the plastic grams of the file info into length
 
 /***********************************************************************/
 
@@ -481,6 +494,7 @@
 #define LIN_ADVANCE
 
 // Unit: mm compression per 1mm/s extruder speed
+// Start value of every plastic driver, M900 D<driver> K<factor> sets each one
 #define LIN_ADVANCE_K 0.0
 
 // If enabled, this will generate debug information output over Serial.
@@ -1180,9 +1194,39 @@
 #define SDSORT_CACHE_VFATS 3      // Maximum number of 13-byte VFAT entries to use for sorting.
                                   // Note: Only affects SCROLL_LONG_FILENAMES with SDSORT_CACHE_NAMES but not SDSORT_DYNAMIC_RAM.
 
-// This function enable the firmware write restart.bin file for restart print when power loss
-//#define SD_RESTART_FILE           // Uncomment to enable
-#define SD_RESTART_FILE_SAVE_TIME 1 // seconds between update
+// Keep the listing of recently visited folders (names, type, size, date and sort order) in RAM.
+// A folder is read from the SD only when first entered or after a card change or a write to the card,
+// so paging through folders with many files on the display does not access the card.
+#define SD_DIR_CACHE
+#define SD_DIR_CACHE_SLOTS  1     // Number of folders kept in the cache
+#define SD_DIR_CACHE_LIMIT  64    // Maximum number of cached items per folder (10-256)
+                                  // RAM: SLOTS * LIMIT * 77 bytes with SCROLL_LONG_FILENAMES (37 without), 4928 bytes as set
+
+// Binary upload to SD over serial with M28 B1 [S<bytes>] <filename> (see src/sd/filetransfer.h).
+// The file is sent in CRC checked frames acknowledged in a window instead of one G-code line per "ok",
+// and written to the SD in multi-block writes, in clusters allocated in advance when the size is given.
+#define BINARY_FILE_TRANSFER
+#define FILE_TRANSFER_PACKET_SIZE 512   // Maximum payload of a frame in bytes (64-1024)
+#define FILE_TRANSFER_BUFFER_SIZE 4096  // Bytes collected before writing to the SD (multiple of 512)
+#define FILE_TRANSFER_WINDOW      4     // Frames the host may send ahead of the acks (1-16, WINDOW * PACKET_SIZE <= BUFFER_SIZE)
+#define FILE_TRANSFER_TIMEOUT     10    // Seconds without data before the transfer is aborted
+
+// Print packed G-code files: G0/G1 moves stored as short binary records, all other lines as plain text.
+// Packed files start with the line ";PACKED 1" and print exactly like the original text file
+// (see CardReader::unpack_line for the format). Files without the header are read as usual.
+#define SD_PACKED_GCODE
+
+// This function enable the firmware write restart.bin file for restart print when power loss.
+// restart.bin is a journal allocated once: every save appends a small record with a single block
+// write, on every layer change and at most every SD_RESTART_FILE_SAVE_TIME seconds in between.
+//#define SD_RESTART_FILE             // Uncomment to enable
+#define SD_RESTART_FILE_SAVE_TIME 1   // seconds between update
+#define SD_RESTART_JOURNAL_BLOCKS 64  // Size of restart.bin in 512 byte blocks (2-1024)
+
+// Count SD card and file system activity: block reads and their latency, retries, CRC errors,
+// busy waits, cache hits and misses, bytes read while printing and time the command queue ran dry.
+// M39 reports the counters, M39 R clears them. They are cleared at the start of every SD print.
+//#define SD_IO_STATS                 // Uncomment to enable
 
 // This enable the firmware to write statistics, that require frequent update on the SD card.
 //#define SD_SETTINGS             // Uncomment to enable
@@ -2198,6 +2242,9 @@
 #define PAUSE_PARK_PRINTER_OFF 0            // (minute) Time limit before turn off printer if user doesn't change filament.
 #define PAUSE_PARK_NUMBER_OF_ALERT_BEEPS 10 // Number of alert beeps before printer goes quiet
 #define PAUSE_PARK_NO_STEPPER_TIMEOUT       // Enable for XYZ steppers to stay powered on during filament change.
+#define PAUSE_FIBER_MAX_WAIT 0              // (seconds) A pause asked during a fiber path waits for its end (M1002) if it
+                                            //   is expected within this time, else the fiber is cut and the print pauses
+                                            //   after the queued moves. Set to 0 to always wait for the end of the path.
 
 //#define PARK_HEAD_ON_PAUSE                  // Park the nozzle during pause and filament change.
 //#define HOME_BEFORE_FILAMENT_CHANGE       // Ensure homing has been completed prior to parking for filament change
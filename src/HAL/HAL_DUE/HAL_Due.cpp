@@ -79,21 +79,9 @@ uint8_t MCUSR;
 int16_t HAL::AnalogInputValues[NUM_ANALOG_INPUTS] = { 0 };
 bool    HAL::Analog_is_ready = false;
 
-#if HEATER_COUNT > 0
-  ADCAveragingFilter HAL::sensorFilters[HEATER_COUNT];
-#endif
-
-#if HAS_FILAMENT_SENSOR
-  ADCAveragingFilter  HAL::filamentFilter;
-#endif
-
-#if HAS_POWER_CONSUMPTION_SENSOR
-  ADCAveragingFilter  HAL::powerFilter;
-#endif
-
-#if HAS_MCU_TEMPERATURE
-  ADCAveragingFilter  HAL::mcuFilter;
-#endif
+adc_channel_t HAL::adc_channels[NUM_ANALOG_INPUTS];
+uint16_t      HAL::adc_active = 0,
+              HAL::adc_buffer[ADC_BUFFER_SIZE];
 
 // disable interrupts
 void cli(void) {
@@ -187,26 +175,11 @@ adc_channel_num_t PinToAdcChannel(pin_t pin) {
   return (adc_channel_num_t)g_APinDescription[pin].ulADCChannelNumber;
 }
 
-// Start converting the enabled channels
-void AnalogInStartConversion() {
-  // Clear out any existing conversion complete bits in the status register
-  for (uint32_t chan = 0; chan < 16; ++chan) {
-    if ((adc_get_status(ADC) & (1 << chan)) != 0) {
-      (void)adc_get_channel_value(ADC, static_cast<adc_channel_num_t>(chan));
-    }
-  }
-  ADC->ADC_CR = ADC_CR_START;
-}
-
-
-// Read the most recent 12-bit result from a pin
-uint16_t AnalogInReadPin(const pin_t r_pin) {
-
-  adc_channel_num_t adc_ch = PinToAdcChannel(r_pin);
-  if ((unsigned int)adc_ch < NUM_ANALOG_INPUTS)
-    return adc_get_channel_value(ADC, adc_ch);
-  else
-    return 0;
+// Point the PDC to the start of the buffer
+FORCE_INLINE void AdcRestartTransfer(uint16_t* buffer) {
+  ADC->ADC_RPR = (uint32_t)buffer;
+  ADC->ADC_RCR = ADC_BUFFER_SIZE;
+  ADC->ADC_PTCR = ADC_PTCR_RXTEN;
 }
 
 // Initialize ADC channels
@@ -231,65 +204,66 @@ void HAL::analogStart(void) {
 
   #if HEATER_COUNT > 0
     LOOP_HEATER() {
-      if (WITHIN(heaters[h].sensor.pin, 0, 15)) {
+      if (WITHIN(heaters[h].sensor.pin, 0, 15))
         AnalogInEnablePin(heaters[h].sensor.pin, true);
-        sensorFilters[h].Init(0);
-      }
     }
   #endif
 
   #if HAS_FILAMENT_SENSOR
     AnalogInEnablePin(FILWIDTH_PIN, true);
-    filamentFilter.Init(0);
   #endif
 
   #if HAS_POWER_CONSUMPTION_SENSOR
     AnalogInEnablePin(POWER_CONSUMPTION_PIN, true);
-    powerFilter.Init(0);
   #endif
 
   #if HAS_MCU_TEMPERATURE
     AnalogInEnablePin(ADC_TEMPERATURE_SENSOR, true);
-    mcuFilter.Init(0);
   #endif
 
   // Initialize ADC mode register (some of the following params are not used here)
   // HW trigger disabled, use external Trigger, 12 bit resolution
-  // core and ref voltage stays on, normal sleep mode, normal not free-run mode
+  // core and ref voltage stays on, normal sleep mode, free-run mode
   // startup time 16 clocks, settling time 17 clocks, no changes on channel switch
   // convert channels in numeric order
   // set prescaler rate  MCK/((PRESCALE+1) * 2)
   // set tracking time  (TRACKTIM+1) * clock periods
   // set transfer period  (TRANSFER * 2 + 3)
   ADC->ADC_MR = ADC_MR_TRGEN_DIS | ADC_MR_TRGSEL_ADC_TRIG0 | ADC_MR_LOWRES_BITS_12 |
-                ADC_MR_SLEEP_NORMAL | ADC_MR_FWUP_OFF | ADC_MR_FREERUN_OFF |
+                ADC_MR_SLEEP_NORMAL | ADC_MR_FWUP_OFF | ADC_MR_FREERUN_ON |
                 ADC_MR_STARTUP_SUT64 | ADC_MR_SETTLING_AST17 | ADC_MR_ANACH_NONE |
                 ADC_MR_USEQ_NUM_ORDER |
                 ADC_MR_PRESCAL(AD_PRESCALE_FACTOR) |
                 ADC_MR_TRACKTIM(AD_TRACKING_CYCLES) |
                 ADC_MR_TRANSFER(AD_TRANSFER_CYCLES);
 
+  ADC->ADC_EMR = ADC_EMR_TAG;   // channel number in the converted data
   ADC->ADC_IER = 0;             // no ADC interrupts
   ADC->ADC_COR = 0;             // Single-ended, no offset
 
-  // start first conversion
-  AnalogInStartConversion();
+  // The PDC stores the conversions, read by Tick every ms
+  AdcRestartTransfer(adc_buffer);
 }
 
 // Enable or disable a channel.
 void HAL::AnalogInEnablePin(const pin_t r_pin, const bool enable) {
-  adc_channel_num_t adc_ch = PinToAdcChannel(r_pin);
+  const adc_channel_num_t adc_ch = PinToAdcChannel(r_pin);
   if ((unsigned int)adc_ch < NUM_ANALOG_INPUTS) {
+    const irqflags_t flags = cpu_irq_save();
     if (enable) {
+      AdcSetupChannel(adc_ch, r_pin);
       adc_enable_channel(ADC, adc_ch);
+      SBI(adc_active, adc_ch);
       if (r_pin == ADC_TEMPERATURE_SENSOR)
         ADC->ADC_ACR |= ADC_ACR_TSON;
     }
     else {
       adc_disable_channel(ADC, adc_ch);
+      CBI(adc_active, adc_ch);
       if (r_pin == ADC_TEMPERATURE_SENSOR)
         ADC->ADC_ACR &= ~ADC_ACR_TSON;
     }
+    cpu_irq_restore(flags);
   }
 }
 
@@ -299,6 +273,104 @@ void HAL::AdcChangePin(const pin_t old_pin, const pin_t new_pin) {
   AnalogInEnablePin(new_pin, true);
 }
 
+// Sample period and moving average by what is connected to the pin
+void HAL::AdcSetupChannel(const uint8_t adc_ch, const pin_t r_pin) {
+
+  adc_channel_t &chan = adc_channels[adc_ch];
+
+  chan.rate     = ADC_AUX_RATE;
+  chan.average  = ADC_AUX_AVERAGE;
+
+  #if HEATER_COUNT > 0
+    LOOP_HEATER() {
+      if (heaters[h].sensor.pin == r_pin) {
+        switch (heaters[h].type) {
+          case IS_HOTEND:
+            chan.rate     = ADC_HOTEND_RATE;
+            chan.average  = ADC_HOTEND_AVERAGE;
+            break;
+          case IS_BED:
+            chan.rate     = ADC_BED_RATE;
+            chan.average  = ADC_BED_AVERAGE;
+            break;
+          default:
+            chan.rate     = ADC_CHAMBER_RATE;
+            chan.average  = ADC_CHAMBER_AVERAGE;
+            break;
+        }
+        break;
+      }
+    }
+  #endif
+
+  chan.pin          = r_pin;
+  chan.countdown    = chan.rate;
+  chan.index        = 0;
+  chan.median_index = 0;
+  chan.valid        = false;
+  chan.acc_sum      = 0;
+  chan.acc_count    = 0;
+}
+
+// Add the conversions stored by the PDC to their channels
+void HAL::AdcCollect() {
+
+  ADC->ADC_PTCR = ADC_PTCR_RXTDIS;
+  const uint16_t count = ADC_BUFFER_SIZE - ADC->ADC_RCR;
+
+  for (uint16_t i = 0; i < count; i++) {
+    const uint16_t data = adc_buffer[i];
+    adc_channel_t &chan = adc_channels[data >> 12];
+    chan.acc_sum += data & 0xFFF;
+    chan.acc_count++;
+  }
+
+  AdcRestartTransfer(adc_buffer);
+}
+
+// Filter the conversions of the period and store the value
+void HAL::AdcSample(adc_channel_t &chan) {
+
+  // Oversampling to ANALOG_INPUT_BITS + OVERSAMPLENR bits
+  const uint16_t value = (chan.acc_sum << OVERSAMPLENR) / chan.acc_count;
+  chan.acc_sum    = 0;
+  chan.acc_count  = 0;
+
+  // First sample fills the filters
+  if (!chan.valid) {
+    chan.median[0] = chan.median[1] = chan.median[2] = value;
+    for (uint8_t i = 0; i < chan.average; i++) chan.readings[i] = value;
+    chan.sum = (uint32_t)value * chan.average;
+    chan.valid = true;
+  }
+
+  #if ENABLED(ADC_MEDIAN_FILTER)
+    chan.median[chan.median_index] = value;
+    if (++chan.median_index == 3) chan.median_index = 0;
+    const uint16_t  a = chan.median[0],
+                    b = chan.median[1],
+                    c = chan.median[2],
+                    filtered = max(min(a, b), min(max(a, b), c));
+  #else
+    const uint16_t filtered = value;
+  #endif
+
+  chan.sum = chan.sum - chan.readings[chan.index] + filtered;
+  chan.readings[chan.index] = filtered;
+  chan.index = (chan.index + 1) & (chan.average - 1);
+
+  const int16_t result = chan.sum / chan.average;
+
+  #if HAS_MCU_TEMPERATURE
+    if (chan.pin == ADC_TEMPERATURE_SENSOR)
+      thermalManager.mcu_current_temperature_raw = result;
+    else
+  #endif
+      AnalogInputValues[chan.pin] = result;
+
+  Analog_is_ready = true;
+}
+
 // Reset peripherals and cpu
 void HAL::resetHardware() {
   // BANZAIIIIIII!!!
@@ -340,11 +412,10 @@ static void TC_SetCMR_ChannelB(Tc *tc, uint32_t chan, uint32_t v) {
   tc->TC_CHANNEL[chan].TC_CMR = (tc->TC_CHANNEL[chan].TC_CMR & 0xF0FFFFFF) | v;
 }
 
-void HAL::analogWrite(pin_t pin, uint32_t ulValue, const uint16_t freq/*=1000*/) {
+void HAL::analogWrite(pin_t pin, uint32_t ulValue, const uint16_t freq/*=1000*/, const uint8_t resolution/*=8*/) {
 
   static uint8_t PWMEnabled = 0;
   static uint8_t TCChanEnabled[] = { 0, 0, 0, 0, 0, 0, 0, 0, 0 };
-  const int writeResolution = 8;
 
   if (isnan(ulValue) || pin <= 0) return;
 
@@ -395,15 +466,47 @@ void HAL::analogWrite(pin_t pin, uint32_t ulValue, const uint16_t freq/*=1000*/)
         dacc_enable_channel(DACC_INTERFACE, chDACC);
 
       // Write user value
-      ulValue = mapResolution(ulValue, writeResolution, DACC_RESOLUTION);
+      ulValue = mapResolution(ulValue, resolution, DACC_RESOLUTION);
       dacc_write_conversion_data(DACC_INTERFACE, ulValue);
       while ((dacc_get_interrupt_status(DACC_INTERFACE) & DACC_ISR_EOC) == 0);
       return;
     }
   }
 
+  if ((attr & PIN_ATTR_PWM) == PIN_ATTR_PWM && resolution > 8) {
+
+    // Own prescaler and period for the channel, the finest that fits the 16 bit period register
+    uint8_t prescaler = 0;
+    while (prescaler < 10 && (VARIANT_MCK >> prescaler) / freq > 0xFFFF) prescaler++;
+    const uint32_t period = (VARIANT_MCK >> prescaler) / freq;
+
+    ulValue = ((uint64_t)ulValue * period) / ((1UL << resolution) - 1);
+
+    if (!PWMEnabled) {
+      pmc_enable_periph_clk(PWM_INTERFACE_ID);
+      PWMC_ConfigureClocks(freq * PWM_MAX_DUTY_CYCLE, 0, VARIANT_MCK);
+      PWMEnabled = 1;
+    }
+
+    const uint32_t chan = pinDesc.ulPWMChannel;
+    if ((g_pinStatus[pin] & 0xF) != PIN_STATUS_PWM) {
+      PIO_Configure(pinDesc.pPort,
+          pinDesc.ulPinType,
+          pinDesc.ulPin,
+          pinDesc.ulPinConfiguration);
+      PWMC_ConfigureChannel(PWM_INTERFACE, chan, prescaler, 0, 0);
+      PWMC_SetPeriod(PWM_INTERFACE, chan, period);
+      PWMC_SetDutyCycle(PWM_INTERFACE, chan, ulValue);
+      PWMC_EnableChannel(PWM_INTERFACE, chan);
+      g_pinStatus[pin] = (g_pinStatus[pin] & 0xF0) | PIN_STATUS_PWM;
+    }
+
+    PWMC_SetDutyCycle(PWM_INTERFACE, chan, ulValue);
+    return;
+  }
+
   if ((attr & PIN_ATTR_PWM) == PIN_ATTR_PWM) {
-    ulValue = mapResolution(ulValue, writeResolution, PWM_RESOLUTION);
+    ulValue = mapResolution(ulValue, resolution, PWM_RESOLUTION);
 
     if (!PWMEnabled) {
       // PWM Startup code
@@ -445,10 +548,8 @@ void HAL::analogWrite(pin_t pin, uint32_t ulValue, const uint16_t freq/*=1000*/)
     // We use MCLK/2 as clock.
     const uint32_t TC = VARIANT_MCK / 2 / freq;
 
-    // Map value to Timer ranges 0..255 => 0..TC
-    ulValue = mapResolution(ulValue, writeResolution, TC_RESOLUTION);
-    ulValue = ulValue * TC;
-    ulValue = ulValue / TC_MAX_DUTY_CYCLE;
+    // Map value to Timer ranges 0..2^resolution-1 => 0..TC
+    ulValue = ((uint64_t)ulValue * TC) / ((1UL << resolution) - 1);
 
     // Setup Timer for this pin
     ETCChannel channel = pinDesc.ulTCChannel;
@@ -503,7 +604,7 @@ void HAL::analogWrite(pin_t pin, uint32_t ulValue, const uint16_t freq/*=1000*/)
   }
 
   // Defaults to digital write
-  ulValue = mapResolution(ulValue, writeResolution, 8);
+  ulValue = mapResolution(ulValue, resolution, 8);
   HAL::pinMode(pin, (ulValue < 128) ? OUTPUT_LOW : OUTPUT_HIGH);
 
 }
@@ -513,7 +614,7 @@ void HAL::analogWrite(pin_t pin, uint32_t ulValue, const uint16_t freq/*=1000*/)
  * It is used to update pwm values for heater and some other frequent jobs.
  *
  *  - Manage PWM to all the heaters and fan
- *  - Prepare or Measure one of the raw ADC sensor values
+ *  - Collect the ADC conversions and sample the channels that are due
  *  - Step the babysteps value for each axis towards 0
  *  - For PINS_DEBUGGING, monitor and report endstop pins
  *  - For ENDSTOP_INTERRUPTS_FEATURE check endstops if flagged
@@ -542,43 +643,28 @@ void HAL::Tick() {
   // read analog values
   #if ANALOG_INPUTS > 0
 
-    if (adc_get_status(ADC)) { // conversion finished?
-
-      #if HEATER_COUNT > 0
-        for (uint8_t h = 0; h < HEATER_COUNT; h++) {
-          if (WITHIN(heaters[h].sensor.pin, 0, 15)) {
-            ADCAveragingFilter& currentFilter = const_cast<ADCAveragingFilter&>(sensorFilters[h]);
-            currentFilter.ProcessReading(AnalogInReadPin(heaters[h].sensor.pin));
-            if (currentFilter.IsValid()) {
-              AnalogInputValues[heaters[h].sensor.pin] = (currentFilter.GetSum() / NUM_ADC_SAMPLES) << OVERSAMPLENR;
-              Analog_is_ready = true;
-            }
-          }
+    AdcCollect();
+
+    // A channel with a rate over 1ms is turned on only for the last ms of its period
+    for (uint8_t adc_ch = 0; adc_ch < NUM_ANALOG_INPUTS; adc_ch++) {
+      if (!TEST(adc_active, adc_ch)) continue;
+      adc_channel_t &chan = adc_channels[adc_ch];
+      if (--chan.countdown == 0) {
+        if (chan.acc_count) {
+          AdcSample(chan);
+          chan.countdown = chan.rate;
+          if (chan.rate > 1) adc_disable_channel(ADC, (adc_channel_num_t)adc_ch);
         }
-      #endif
-
-      #if HAS_FILAMENT_SENSOR
-        const_cast<ADCAveragingFilter&>(filamentFilter).ProcessReading(AnalogInReadPin(FILWIDTH_PIN));
-        if (filamentFilter.IsValid())
-          AnalogInputValues[FILWIDTH_PIN] = (filamentFilter.GetSum() / NUM_ADC_SAMPLES) << OVERSAMPLENR;
-      #endif
-
-      #if HAS_POWER_CONSUMPTION_SENSOR
-        const_cast<ADCAveragingFilter&>(powerFilter).ProcessReading(AnalogInReadPin(POWER_CONSUMPTION_PIN));
-        if (powerFilter.IsValid())
-          AnalogInputValues[POWER_CONSUMPTION_PIN] = (powerFilter.GetSum() / NUM_ADC_SAMPLES) << OVERSAMPLENR;
-      #endif
-
-      #if HAS_MCU_TEMPERATURE
-        const_cast<ADCAveragingFilter&>(mcuFilter).ProcessReading(AnalogInReadPin(ADC_TEMPERATURE_SENSOR));
-        if (mcuFilter.IsValid())
-          thermalManager.mcu_current_temperature_raw = (mcuFilter.GetSum() / NUM_ADC_SAMPLES) << OVERSAMPLENR;
-      #endif
-
+        else
+          chan.countdown = 1; // No conversion yet
+      }
+      else if (chan.countdown == 1) {
+        chan.acc_sum    = 0;
+        chan.acc_count  = 0;
+        adc_enable_channel(ADC, (adc_channel_num_t)adc_ch);
+      }
     }
 
-    AnalogInStartConversion();
-
     // Update the raw values if they've been read. Else we could be updating them during reading.
     if (HAL::Analog_is_ready) thermalManager.set_current_temp_raw();
 
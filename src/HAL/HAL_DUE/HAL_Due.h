@@ -206,8 +206,10 @@ typedef uint32_t  ptr_int_t;
 #define AD_RANGE  (1 << (ANALOG_INPUT_BITS + OVERSAMPLENR))
 
 #define ABS_ZERO  -273.15
-#define NUM_ADC_SAMPLES 32
 #define ADC_TEMPERATURE_SENSOR 15
+// Conversions stored by the PDC between two Tick, the ADC does about 25 per ms
+#define ADC_BUFFER_SIZE 64
+#define ADC_AVERAGE_MAX 32
 
 #define HARDWARE_PWM true
 
@@ -226,50 +228,22 @@ volatile static uint32_t debug_counter;
 extern "C" char *sbrk(int i);
 extern "C" char *dtostrf (double __val, signed char __width, unsigned char __prec, char *__s);
 
-// Class to perform averaging of values read from the ADC
-// numAveraged should be a power of 2 for best efficiency
-template <size_t numAveraged> class AveragingFilter {
-
-  public: /** Constructor */
-
-    AveragingFilter() { Init(0); }
-
-  private: /** Private Parameters */
-
-    uint16_t  readings[numAveraged];
-    size_t    index;
-    uint32_t  sum;
-    bool      valid;
-
-  public: /** Public Function */
-
-    void Init(uint16_t val) volatile {
-
-      irqflags_t flags = cpu_irq_save();
-      sum = (uint32_t)val * (uint32_t)numAveraged;
-      index = 0;
-      valid = false;
-      for (size_t i = 0; i < numAveraged; ++i)
-        readings[i] = val;
-      cpu_irq_restore(flags);
-    }
-
-    void ProcessReading(const uint16_t read) {
-      sum = sum - readings[index] + read;
-      readings[index] = read;
-      if (++index == numAveraged) {
-        index = 0;
-        valid = true;
-      }
-    }
-
-    uint32_t GetSum() const volatile { return sum; }
-
-    bool IsValid() const volatile	{ return valid; }
-
-};
-
-typedef AveragingFilter<NUM_ADC_SAMPLES> ADCAveragingFilter;
+// One ADC channel of the pipeline. The conversions of a sample period are summed
+// (oversampling), then go through the median of the last 3 samples and a moving average.
+typedef struct {
+  pin_t     pin;
+  uint8_t   rate,                         // Sample period in ms
+            countdown,                    // ms to the next sample
+            average,                      // Moving average length, power of 2
+            index,
+            median_index;
+  bool      valid;
+  uint16_t  acc_count,
+            median[3],
+            readings[ADC_AVERAGE_MAX];
+  uint32_t  acc_sum,
+            sum;
+} adc_channel_t;
 
 class HAL {
 
@@ -287,21 +261,9 @@ class HAL {
 
   private: /** Private Parameters */
 
-    #if HEATER_COUNT > 0
-      static ADCAveragingFilter sensorFilters[HEATER_COUNT];
-    #endif
-
-    #if HAS_FILAMENT_SENSOR
-      static ADCAveragingFilter filamentFilter;
-    #endif
-
-    #if HAS_POWER_CONSUMPTION_SENSOR
-      static ADCAveragingFilter powerFilter;
-    #endif
-
-    #if HAS_MCU_TEMPERATURE
-      static ADCAveragingFilter mcuFilter;
-    #endif
+    static adc_channel_t adc_channels[NUM_ANALOG_INPUTS];
+    static uint16_t adc_active,
+                    adc_buffer[ADC_BUFFER_SIZE];
 
   public: /** Public Function */
 
@@ -314,7 +276,7 @@ class HAL {
     static bool pwm_status(const pin_t pin);
     static bool tc_status(const pin_t pin);
 
-    static void analogWrite(const pin_t pin, uint32_t ulValue, const uint16_t freq=1000);
+    static void analogWrite(const pin_t pin, uint32_t ulValue, const uint16_t freq=1000, const uint8_t resolution=8);
 
     static void Tick();
 
@@ -425,6 +387,12 @@ class HAL {
       static void spiSendBlock(uint8_t token, const uint8_t* buf);
     #endif
 
+  private: /** Private Function */
+
+    static void AdcSetupChannel(const uint8_t adc_ch, const pin_t r_pin);
+    static void AdcCollect();
+    static void AdcSample(adc_channel_t &chan);
+
 };
 
 /**
@@ -55,6 +55,15 @@ void Commands::flush_and_request_resend() {
 }
 
 void Commands::get_available() {
+
+  #if HAS_FILE_TRANSFER
+    // During a binary upload the serial input belongs to the file transfer
+    if (filetransfer.active) {
+      filetransfer.receive();
+      return;
+    }
+  #endif
+
   if (buffer_ring.isFull()) return;
 
   // if any immediate commands remain, don't get other commands yet
@@ -71,6 +80,10 @@ void Commands::advance_queue() {
   // Process immediate commands
   if (process_injected_front()) return;
 
+  #if HAS_SD_IO_STATS
+    card.check_queue_empty(IS_SD_PRINTING && buffer_ring.isEmpty());
+  #endif
+
   // Return if the G-code buffer is empty
   if (!buffer_ring.count()) return;
 
@@ -194,7 +207,7 @@ void Commands::get_destination() {
   }
 
   #if HAS_SD_RESTART
-    if (restart.enabled && IS_SD_PRINTING() && (seen[E_AXIS] || seen[Z_AXIS])) restart.save_job();
+    if (restart.enabled && IS_SD_PRINTING && (seen[E_AXIS] || seen[Z_AXIS])) restart.save_job();
   #endif
 
   if (parser.linearval('F') > 0)
@@ -290,6 +303,38 @@ bool Commands::get_target_heater(int8_t &h) {
   }
 }
 
+char Commands::peek_command(const char* &p, int16_t &code) {
+
+  while (*p == ' ') p++;
+  if (*p == 'N') {
+    p++;
+    while (NUMERIC_SIGNED(*p) || *p == ' ') p++;
+  }
+
+  const char letter = *p;
+  if (!WITHIN(letter, 'A', 'Z')) return '\0';
+
+  code = strtol(p + 1, (char**)&p, 10);
+  return letter;
+}
+
+char Commands::peek_param(const char* &p, long &value) {
+  while (*p && *p != ';' && *p != '*') {
+    const char c = *p++;
+    if (WITHIN(c, 'A', 'Z')) {
+      value = strtol(p, (char**)&p, 10);
+      return c;
+    }
+  }
+  return '\0';
+}
+
+const char* Commands::queued_line(const uint8_t i) {
+  uint16_t index = buffer_ring.head() + i;
+  if (index >= BUFSIZE) index -= BUFSIZE;
+  return buffer_ring.item(index).gcode;
+}
+
 #if HAS_FANS
   bool Commands::get_target_fan(uint8_t &f) {
     f = parser.seen('P') ? parser.value_byte() : 0;
@@ -512,10 +557,18 @@ void Commands::get_serial() {
     while (!buffer_ring.isFull() && !card_eof && !stop_buffering) {
       const int16_t n = card.get();
       char sd_char = (char)n;
+      #if HAS_SD_PACKED_GCODE
+        // A byte with the high bit set at the start of a line is a packed G0/G1 move
+        const bool packed_line = card.packed_file && card.packed_line_start && n >= 0x80;
+        if (packed_line) sd_count = card.unpack_line(n, sd_line_buffer);
+        card.packed_line_start = packed_line || sd_char == '\n';
+      #else
+        constexpr bool packed_line = false;
+      #endif
       card_eof = card.eof();
       last_command_ms = millis();
       printer.max_inactivity_watch.start();
-      if (card_eof || n == -1
+      if (card_eof || n == -1 || packed_line
           || sd_char == '\n'  || sd_char == '\r'
           || ((sd_char == '#' || sd_char == ':') && !sd_comment_mode)
       ) {
@@ -648,7 +701,7 @@ bool Commands::enqueue(const char * cmd, bool say_ok/*=false*/, int8_t port/*=-2
   temp_cmd.s_port = port;
   temp_cmd.send_ok = say_ok;
   #if HAS_SD_RESTART
-    restart.set_sdpos();
+    temp_cmd.sdpos = restart.cmd_sdpos;
   #endif
   buffer_ring.enqueue(temp_cmd);
   return true;
@@ -37,6 +37,9 @@ struct gcode_t {
   int8_t  s_port  = -1;         // Serial port for print information:
                                 //    -1 for all port
                                 //    -2 for SD or null port
+  #if HAS_SD_RESTART
+    uint32_t sdpos = 0;         // SD position of the command, for restart
+  #endif
 };
 
 class Commands {
@@ -83,6 +86,13 @@ class Commands {
 
   public: /** Public Function */
 
+    /**
+     * Copy a command from RAM into the main command buffer.
+     * Return true if the command was successfully added.
+     * Return false for a full buffer, or if the 'command' is a comment.
+     */
+    static bool enqueue(const char * cmd, bool say_ok=false, int8_t port=-2);
+
     /**
      * Send a "Resend: nnn" message to the host to
      * indicate that a command needs to be re-sent.
@@ -168,6 +178,23 @@ class Commands {
      */
     static bool get_target_heater(int8_t &h);
 
+    /**
+     * Look ahead in a G-code line without the parser, for the lines waiting
+     * in the buffer_ring or read ahead from the SD.
+     *
+     * peek_command() skips the spaces and the N<line>, returns the command
+     * letter ('\0' if none) and its number in code, p is left on the parameters.
+     * peek_param() returns the next parameter letter with its integer value,
+     * '\0' at the end of the line, at the '*' checksum or at a ';' comment.
+     */
+    static char peek_command(const char* &p, int16_t &code);
+    static char peek_param(const char* &p, long &value);
+
+    /**
+     * Line i of the buffer_ring, 0 is the next to run
+     */
+    static const char* queued_line(const uint8_t i);
+
     #if HAS_FANS
       /**
        * Set target fan from the P parameter
@@ -222,13 +249,6 @@ class Commands {
      */
     static bool enqueue_one(const char * cmd);
 
-    /**
-     * Copy a command from RAM into the main command buffer.
-     * Return true if the command was successfully added.
-     * Return false for a full buffer, or if the 'command' is a comment.
-     */
-    static bool enqueue(const char * cmd, bool say_ok=false, int8_t port=-2);
-
     /**
      * Process the next "immediate" command
      */
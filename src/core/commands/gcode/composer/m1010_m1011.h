@@ -33,19 +33,20 @@
   *
   */
  inline void gcode_M1010(void) {
-	 tools.cut_fiber();
+	 tools.queue_fiber_cut();
  }
 
 
 /*
  * M1011: Fiber cut Parameters
  *
- *  S<servo-id> A<cut-angle> B<neutral-angle>
+ *  S<servo-id> A<cut-angle> B<neutral-angle> D<dwell-ms>
  *
  */
 inline void gcode_M1011() {
 	  if (parser.seen('S')) Tools::cut_servo_id = parser.value_byte();
 	  if (parser.seen('A')) Tools::cut_active_angle = parser.value_byte();
 	  if (parser.seen('B')) Tools::cut_neutral_angle = parser.value_byte();
+	  if (parser.seen('D')) Tools::cut_dwell = parser.value_ushort();
 }
 
@@ -25,40 +25,31 @@
  *
  */
 
-  #define CODE_M1012
-  
- /*
-  * M1012: Test switch
-  *
-  */
- inline void gcode_M1012(void) {
-	StateMessage::ActivatePGM(MESSAGE_CRITICAL_ERROR, NEX_ICON_WARNING, "Switch Test", "0", 0, 0, 0, 0, 0);
-	#if EXTRUDERS > 1 && HOTENDS > 1
-
-	int switchCount = 0;
-
-	Temperature::tempError = false;
-
-	while (!Temperature::tempError)
-	{
-		uint8_t new_extruder = 0;
-		if (tools.active_extruder == 0) new_extruder = 1;
-
-		if (printer.mode == PRINTER_MODE_FFF) {
-			 tools.change(new_extruder);
-		}
-		switchCount++;
-		String str = String(switchCount);
-		StateMessage::UpdateMessage(str.c_str());
-	}
-
-	sprintf_P(NextionHMI::buffer, "Temperature failure. T=%d. Switch number: %d.", (int)heaters[0].current_temperature, switchCount);
-	StateMessage::UpdateMessage(NextionHMI::buffer);
-
-	#endif
-	 //tools.cut_fiber();
- }
-
-
+#if HAS_SWITCH_TEST
 
+  #define CODE_M1012
 
+  /**
+   * M1012: Tool switch endurance test
+   *
+   *  S<switches>   Start the test, S0 until stopped (default)
+   *  C<switches>   Check the X Y endstops every these switches, 0 never (default)
+   *  E<mm>         Stop on an endstop deviation over this, 0 no limit (default)
+   *  M<ms>         Stop on a switch slower than this, 0 no limit (default)
+   *
+   *  X             Stop the test
+   *  H             Check the X Y endstops now
+   *  R             Report the test
+   *  P             Print the log of the last switches
+   *
+   *  With no parameter the test runs until stopped.
+   */
+  inline void gcode_M1012(void) {
+    if (parser.seen('X'))       switchtest.stop(PSTR("stopped"));
+    else if (parser.seen('H'))  switchtest.check_endstops();
+    else if (parser.seen('R'))  switchtest.report();
+    else if (parser.seen('P'))  switchtest.dump();
+    else switchtest.start(parser.ulongval('S'), parser.ushortval('C'), parser.floatval('E'), parser.ushortval('M'));
+  }
+
+#endif // HAS_SWITCH_TEST
@@ -30,8 +30,10 @@
  /*
   *
   * M1013: Park/Unpark nozzle for heating near wipe station
-  * M1013 - Park
+  * M1013 - Park, return when the nozzle is there
   * M1013 R - Return
+  * M1013 S<temp> [T<tool>] [R] - Park, heat the tool (the next one if no T) while
+  *   parking, wait for the last of the two and, with R, return at once
   *
   */
 
@@ -39,17 +41,24 @@
 
  inline void gcode_M1013(void) {
 	#if ENABLED(EG6_EXTRUDER)
-		if (parser.seen('R') )
+		if (parser.seenval('S'))
+		{
+			const int16_t temp = parser.value_celsius();
+			const uint8_t tool = parser.seenval('T') ? parser.value_byte() : (tools.active_extruder == 0 ? 1 : 0);
+			if (tool >= HOTENDS) {
+				SERIAL_LMV(ER, MSG_INVALID_EXTRUDER " ", (int)tool);
+				return;
+			}
+			tools.park_heat_return(tool, temp, parser.seen('R'));
+		}
+		else if (parser.seen('R') )
 		{
 			tools.unpark_from_wipe();
 		}
 		else
 		{
 			tools.park_to_wipe();
+			stepper.synchronize();
 		}
 	#endif
  }
-
-
-
-
@@ -0,0 +1,50 @@
+/**
+ * MK4duo Firmware for 3D Printer, Laser and CNC
+ *
+ * Based on Marlin, Sprinter and grbl
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ * Copyright (C) 2013 Alberto Cotronei @MagoKimbra
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * mcode
+ *
+ */
+
+#define CODE_M1014
+
+/**
+ * M1014: Extrusion and spool accounting
+ *
+ *  D<driver>   Extruder driver of the spool (default 0)
+ *  L<m>        Length left on the spool, L-1 unknown
+ *
+ *  Reports the job extrusion of every extruder driver, what the file expects,
+ *  the spool left and, while printing, what the job still needs.
+ */
+inline void gcode_M1014(void) {
+  if (parser.seenval('L')) {
+    const float left = parser.value_float();
+    const uint8_t d = parser.byteval('D');
+    if (d >= DRIVER_EXTRUDERS) {
+      SERIAL_LMV(ER, "Invalid extruder driver D", (int)d);
+      return;
+    }
+    print_job_counter.setSpool(d, left < 0 ? -1.0 : left * 1000.0);
+  }
+  print_job_counter.showExtruded();
+}
@@ -35,24 +35,78 @@
    *
    *  A<x_offset> B<y_offset> T<target_tool> S<step (0-11) X<x_pos> Y<y_pos> V<speed mm/s> K<switch movement 0/1>
    *
+   *  T<target_tool> S<step> with no X Y V K reports the move, T<target_tool> alone the whole path.
+   *  The moves and the offsets out of CHANGE_MOVES_MIN_POS / CHANGE_MOVES_MAX_POS or over
+   *  the X max feedrate are refused. M500 S stores the path in EEPROM.
+   *
    */
+  inline void print_M217_step(const uint8_t h, const uint8_t step) {
+	  const ToolSwitchPos &move = Tools::hotend_switch_path[h][step];
+	  SERIAL_SMV(ECHO, "M217 T", (int)h);
+	  SERIAL_MV(" S", (int)step);
+	  SERIAL_MV(" X", move.X, 2);
+	  SERIAL_MV(" Y", move.Y, 2);
+	  SERIAL_MV(" V", move.Speed, 2);
+	  SERIAL_EMV(" K", move.SwitchMove);
+  }
+
   inline void gcode_M217() {
-	  if (parser.seen('A')) Tools::switch_offset_x = parser.value_linear_units();
-	  if (parser.seen('B')) Tools::switch_offset_y = parser.value_linear_units();
 
 	  GET_TARGET_EXTRUDER(217);
+
+	  const bool offset = parser.seen('A') || parser.seen('B');
+	  if (offset)
+	  {
+		  const float old_x = Tools::switch_offset_x,
+		              old_y = Tools::switch_offset_y;
+		  if (parser.seen('A')) Tools::switch_offset_x = parser.value_linear_units();
+		  if (parser.seen('B')) Tools::switch_offset_y = parser.value_linear_units();
+		  LOOP_HOTEND()
+		  {
+			  if (!Tools::switch_path_valid(h))
+			  {
+				  Tools::switch_offset_x = old_x;
+				  Tools::switch_offset_y = old_y;
+				  SERIAL_LMV(ER, "M217: offset moves the switch path out of limits, T", (int)h);
+				  return;
+			  }
+		  }
+	  }
+
 	  if (parser.seen('S'))
 	  {
 		  uint8_t step = parser.value_byte();
 		  if (step>=CHANGE_MOVES)
 		  {
+			  SERIAL_LMV(ER, "M217: step out of 0-", CHANGE_MOVES - 1);
 			  return;
 		  }
-		  if (parser.seen('X')) Tools::hotend_switch_path[TARGET_EXTRUDER][step].X = parser.value_linear_units();
-		  if (parser.seen('Y')) Tools::hotend_switch_path[TARGET_EXTRUDER][step].Y = parser.value_linear_units();
-		  if (parser.seen('V')) Tools::hotend_switch_path[TARGET_EXTRUDER][step].Speed = parser.value_linear_units();
-		  if (parser.seen('K')) Tools::hotend_switch_path[TARGET_EXTRUDER][step].SwitchMove = parser.value_bool();
 
+		  // Checked as a whole, a refused move leaves the path as it was
+		  ToolSwitchPos move = Tools::hotend_switch_path[TARGET_EXTRUDER][step];
+		  const bool edit = parser.seen('X') || parser.seen('Y') || parser.seen('V') || parser.seen('K');
+		  if (parser.seen('X')) move.X = parser.value_linear_units();
+		  if (parser.seen('Y')) move.Y = parser.value_linear_units();
+		  if (parser.seen('V')) move.Speed = parser.value_linear_units();
+		  if (parser.seen('K')) move.SwitchMove = parser.value_bool();
+
+		  if (edit)
+		  {
+			  if (!Tools::switch_move_valid(move))
+			  {
+				  SERIAL_LMV(ER, "M217: move out of limits, S", (int)step);
+				  return;
+			  }
+			  Tools::hotend_switch_path[TARGET_EXTRUDER][step] = move;
+		  }
+		  else
+			  print_M217_step(TARGET_EXTRUDER, step);
+	  }
+	  else if (!offset)
+	  {
+		  SERIAL_SMV(ECHO, "M217 A", Tools::switch_offset_x, 2);
+		  SERIAL_EMV(" B", Tools::switch_offset_y, 2);
+		  for (uint8_t i = 0; i < CHANGE_MOVES; i++) print_M217_step(TARGET_EXTRUDER, i);
 	  }
 
   }
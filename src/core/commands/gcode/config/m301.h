@@ -29,7 +29,7 @@
 #define CODE_M301
 
 /**
- * M301: Set PID parameters P I D (and optionally C, L)
+ * M301: Set PID parameters P I D (and optionally C, L, F, A)
  *
  *   H[heaters] H = 0-3 Hotend, H = -1 BED, H = -2 CHAMBER, H = -3 COOLER
  *
@@ -41,6 +41,11 @@
  *
  *   C[float] Kc term
  *   L[float] LPQ length
+ *
+ * With PID_FEEDFORWARD:
+ *
+ *   F[float] Kf term, power per mm3/s of plastic
+ *   A[float] Kl term, power per degree over 25C
  */
 inline void gcode_M301(void) {
 
@@ -58,6 +63,10 @@ inline void gcode_M301(void) {
     if (parser.seen('L')) tools.lpq_len = parser.value_float();
     NOMORE(tools.lpq_len, LPQ_MAX_LEN);
   #endif
+  #if ENABLED(PID_FEEDFORWARD)
+    if (parser.seen('F')) heaters[h].Kf = parser.value_float();
+    if (parser.seen('A')) heaters[h].Kl = parser.value_float();
+  #endif
 
   heaters[h].updatePID();
   heaters[h].print_PID(false);
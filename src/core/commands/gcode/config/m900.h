@@ -34,19 +34,36 @@
    * M900: Set Linear Advance K-factor
    *
    *  K<factor>   Set advance K factor
+   *  D<driver>   Extruder driver of the factor, all of them if omitted
+   *
+   *  Only the plastic drivers use advance, the fiber drivers ignore their factor.
    */
   inline void gcode_M900(void) {
     if (parser.seenval('K')) {
-      const float newK = parser.floatval('K');
-      if (WITHIN(newK, 0, 10)) {
-        stepper.synchronize();
-        planner.extruder_advance_K = newK;
+      const float newK = parser.value_float();
+      if (!WITHIN(newK, 0, 10)) {
+        SERIAL_EM("?K value out of range (0-10).");
+        return;
+      }
+      const bool all = !parser.seenval('D');
+      const uint8_t d = all ? 0 : parser.value_byte();
+      if (d >= DRIVER_EXTRUDERS) {
+        SERIAL_LMV(ER, "Invalid extruder driver D", (int)d);
+        return;
       }
+      stepper.synchronize();
+      if (all)
+        LOOP_EXTRUDERS(ie) planner.extruder_advance_K[ie] = newK;
       else
-        SERIAL_EM("?K value out of range (0-10).");
+        planner.extruder_advance_K[d] = newK;
+    }
+    else {
+      LOOP_EXTRUDERS(ie) {
+        if (!tools.extruder_driver_is_plastic(AxisEnum(E_AXIS + ie))) continue;
+        SERIAL_SMV(ECHO, "Advance D", (int)ie);
+        SERIAL_EMV(" K=", planner.extruder_advance_K[ie]);
+      }
     }
-    else
-      SERIAL_LMV(ECHO, "Advance K=", planner.extruder_advance_K);
   }
 
 #endif // ENABLED(LIN_ADVANCE)
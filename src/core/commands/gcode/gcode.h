@@ -203,16 +203,20 @@
 #include "stats/m76.h"
 #include "stats/m77.h"
 #include "stats/m78.h"
+#include "stats/m157.h"
+#include "stats/m158.h"
 
 // Temperature Commands
 #include "temperature/m104.h"
 #include "temperature/m105.h"
 #include "temperature/m108.h"
 #include "temperature/m109.h"
+#include "temperature/m116.h"
 #include "temperature/m140.h"
 #include "temperature/m141.h"
 #include "temperature/m142.h"
 #include "temperature/m155.h"
+#include "temperature/m156.h"
 #include "temperature/m190.h"
 #include "temperature/m191.h"
 #include "temperature/m192.h"
@@ -233,6 +237,7 @@
 #include "composer/m1010_m1011.h"
 #include "composer/m1012.h"
 #include "composer/m1013.h"
+#include "composer/m1014.h"
 #include "composer/m704.h"
 #include "composer/m217.h"
 
@@ -79,7 +79,7 @@
    */
   inline void gcode_M24(void) {
     #if HAS_SD_RESTART
-      card.delete_restart_file();
+      restart.end_job();
     #endif
 
     #if ENABLED(PARK_HEAD_ON_PAUSE) && ENABLED(ADVANCED_PAUSE_FEATURE)
@@ -164,8 +164,26 @@
 
   /**
    * M28: Start SD Write
+   *
+   *  M28 B1 [S<bytes>] <filename> - Binary upload, see filetransfer.h
    */
-  inline void gcode_M28(void) { card.startWrite(parser.string_arg, false); }
+  inline void gcode_M28(void) {
+    #if HAS_FILE_TRANSFER
+      char *p = parser.string_arg;
+      if (p && p[0] == 'B' && p[1] == '1' && p[2] == ' ') {
+        uint32_t size = 0;
+        p += 3;
+        while (*p == ' ') p++;
+        if (*p == 'S') {
+          size = strtoul(p + 1, &p, 10);
+          while (*p == ' ') p++;
+        }
+        filetransfer.start(p, size);
+        return;
+      }
+    #endif
+    card.startWrite(parser.string_arg, false);
+  }
 
   /**
    * M29: Stop SD Write
@@ -235,4 +253,22 @@
 
   #endif // SDCARD_SORT_ALPHA && SDSORT_GCODE
 
+  #if HAS_SD_IO_STATS
+
+    #define CODE_M39
+
+    /**
+     * M39: Report the SD I/O counters
+     *
+     *  R - Clear the counters
+     */
+    inline void gcode_M39(void) {
+      if (parser.seen('R'))
+        card.reset_io_stats();
+      else
+        card.print_io_stats();
+    }
+
+  #endif // HAS_SD_IO_STATS
+
 #endif // HAS_SDSUPPORT
@@ -0,0 +1,55 @@
+/**
+ * MK4duo Firmware for 3D Printer, Laser and CNC
+ *
+ * Based on Marlin, Sprinter and grbl
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ * Copyright (C) 2013 Alberto Cotronei @MagoKimbra
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * mcode
+ *
+ * Copyright (C) 2017 Alberto Cotronei @MagoKimbra
+ */
+
+#if HAS_THERMAL_LOG
+
+  #define CODE_M156
+
+  /**
+   * M156: Thermal log
+   *
+   *       S<cycles> take a sample every <cycles> temperature cycles (100ms), S0 pauses the log
+   *       R         clear the log and start again, also after a heater error
+   *       D<1/2>    dump the log, 1 as CSV lines, 2 as binary rows
+   *
+   * Without parameters reports the state of the log.
+   */
+  inline void gcode_M156(void) {
+
+    if (parser.seen('D')) {
+      thermallog.dump(parser.value_int() == 2);
+      return;
+    }
+
+    if (parser.seen('R')) thermallog.clear();
+    if (parser.seen('S')) thermallog.set_interval(parser.value_byte());
+
+    thermallog.report();
+  }
+
+#endif // HAS_THERMAL_LOG
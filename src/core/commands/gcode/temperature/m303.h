@@ -32,10 +32,14 @@
  * M303: PID relay autotune
  *
  *       S<temperature> sets the target temperature. (default target temperature = 150C)
+ *                      S0 stops the autotune of the heater
  *       H<hotend> (-1 for the bed, -2 for chamber, -3 for cooler) (default 0)
  *       C<cycles>
- *       R<method> (0 - 3)
- *       U<bool> with a non-zero value will apply the result to current settings
+ *       R<method> (0 - 4)
+ *       U<bool> with a non-zero value will store the result in EEPROM
+ *
+ * The autotune runs in the background, send one M303 for each heater
+ * to tune them together. Progress and results are reported on serial.
  */
 inline void gcode_M303(void) {
 
@@ -48,6 +52,13 @@ inline void gcode_M303(void) {
 
   if (!commands.get_target_heater(h)) return;
 
+  if (thermalManager.isAutotuning(h)) {
+    if (temp == 0) thermalManager.autotune_stop(&heaters[h], PSTR("stopped"));
+    else SERIAL_LM(ER, MSG_PID_AUTOTUNE " already running");
+    return;
+  }
+  if (temp == 0) return;
+
   SERIAL_EM(MSG_PID_AUTOTUNE_START);
 
   if (heaters[h].type == IS_HOTEND)
@@ -73,7 +84,7 @@ inline void gcode_M303(void) {
   SERIAL_MV(" Temp:", temp);
   SERIAL_MV(" Cycles:", cycle);
   SERIAL_MV(" Method:", method);
-  if (store) SERIAL_MSG(" Apply result");
+  if (store) SERIAL_MSG(" Store result");
   SERIAL_EOL();
 
   thermalManager.PID_autotune(&heaters[h], temp, cycle, method, store);
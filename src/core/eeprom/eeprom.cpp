@@ -43,12 +43,15 @@
 
 #if ENABLED(EEPROM_MULTIPART)
 	#define USRCFG_VERSION "MKA12"
-	#define SYSCFG_VERSION "SC11"
+	#define SYSCFG_VERSION "SC12"
 
 	#define USRCFG_OFFSET 	0
 	#define SYSCFG_OFFSET   4096
+	#define STATS_OFFSET 	31744
 	#define CONST_OFFSET 	32000
 
+	#define STATS_VERSION "ST01"
+
 /**
  *
  * MKA12 EEPROM Layout:
@@ -57,6 +60,11 @@
  *  Serial Number												(char x10)
  *  Printer version												(char x6)
  *
+ * ****************************** STATS *********************************
+ *  Version                                                     (char x6)
+ *  Checksum                                                    (uint16_t)
+ *  M158                  print_job_counter.data.toolLife       (uint32_t x(3*HOTENDS+4))
+ *
  *
  * ****************************** CONFIG *********************************
  *
@@ -83,6 +91,7 @@
  *  M301  H-1 PID         Kp, Ki, Kd                            (float x3)
  *  M301  H-2 PID         Kp, Ki, Kd                            (float x3)
  *  M301  H-3 PID         Kp, Ki, Kd                            (float x3)
+ *  M301  H0..3 F A       Kf[0..3], Kl[0..3]                    (float x2 x4)  PID_FEEDFORWARD
  *
  * *************************** SYSTEM CONFIG *****************************
  *
@@ -129,7 +138,7 @@
  *  M106  P   SFHULI      Fans parameters
  *
  *  LIN_ADVANCE:
- *  M900  K               planner.extruder_advance_K         (float)
+ *  M900  D K             planner.extruder_advance_K         (float x DRIVER_EXTRUDERS)
  *
  *  FILAMENT_CHANGE:
  *  M704 E0..6 Lx      	  PrintPause::LoadDistance[0..6]     (float x6)
@@ -146,7 +155,7 @@
  *  M1011 Bx			  tools.cut_neutral_angle			 (uint8_t)
  *
  *  TOOL_CHANGE:
- *  M217         		  tools.switch_tool_path			 (24*(3*float+bool))
+ *  M217  T S XYVK 	  tools.hotend_switch_path			 (HOTENDS*CHANGE_MOVES*(3*float+bool))
  */
 
  char    EEPROM::printerSN[17] = "";   // max. 16 chars + 0
@@ -159,9 +168,9 @@
 
 
 #else
-	#define EEPROM_VERSION "MKV45"
+	#define EEPROM_VERSION "MKV46"
 /**
- * MKV45 EEPROM Layout:
+ * MKV46 EEPROM Layout:
  *
  *  Version                                                     (char x6)
  *  EEPROM Checksum                                             (uint16_t)
@@ -236,6 +245,7 @@
  *  M301  H2  PIDC        Kp[2], Ki[2], Kd[2], Kc[2]            (float x4)
  *  M301  H3  PIDC        Kp[3], Ki[3], Kd[3], Kc[3]            (float x4)
  *  M301  L               lpq_len                               (int   x1)
+ *  M301  H0..3 F A       Kf[0..3], Kl[0..3]                    (float x2 x4)  PID_FEEDFORWARD
  *  M301  H-1 PID         Kp, Ki, Kd                            (float x3)
  *  M301  H-2 PID         Kp, Ki, Kd                            (float x3)
  *  M301  H-3 PID         Kp, Ki, Kd                            (float x3)
@@ -307,7 +317,7 @@
  *  M914  Z               Stepper Z and Z2 threshold            (int16_t)
  *
  * LIN_ADVANCE:
- *  M900  K               planner.extruder_advance_K            (float)
+ *  M900  D K             planner.extruder_advance_K            (float x DRIVER_EXTRUDERS)
  *
  * ADVANCED_PAUSE_FEATURE:
  *  M603 U                filament_change_unload_length         (float)
@@ -522,6 +532,62 @@ void EEPROM::Postprocess() {
       return !eeprom_error;
     }
 
+    #if HOTENDS > 1
+
+      /**
+       * Life tool change statistics, written at the end of every print
+       */
+      bool EEPROM::Store_Stats() {
+
+        const char stats_version[6] = STATS_VERSION;
+        uint16_t working_crc = 0;
+
+        EEPROM_WRITE_START(STATS_OFFSET);
+        EEPROM_SKIP(stats_version);
+        EEPROM_SKIP(working_crc);
+
+        working_crc = 0;
+        EEPROM_WRITE(print_job_counter.data.toolLife);
+
+        if (!eeprom_error) {
+          const uint16_t final_crc = working_crc;
+          eeprom_index = EEPROM_OFFSET + STATS_OFFSET;
+          EEPROM_WRITE(stats_version);
+          EEPROM_WRITE(final_crc);
+        }
+
+        EEPROM_FINISH();
+
+        return !eeprom_error;
+      }
+
+      bool EEPROM::Load_Stats() {
+
+        const char stats_version[6] = STATS_VERSION;
+        char stored_ver[6];
+        uint16_t  working_crc = 0,
+                  stored_crc  = 0;
+        toolStatistics stored;
+
+        EEPROM_READ_START(STATS_OFFSET);
+        EEPROM_READ(stored_ver);
+        EEPROM_READ(stored_crc);
+
+        working_crc = 0;
+        EEPROM_READ(stored);
+
+        EEPROM_FINISH();
+
+        // Empty or older EEPROM, the statistics start from zero
+        if (eeprom_error || strncmp(stats_version, stored_ver, 5) != 0 || working_crc != stored_crc)
+          return false;
+
+        print_job_counter.data.toolLife = stored;
+        return true;
+      }
+
+    #endif // HOTENDS > 1
+
     bool EEPROM::Store_Sys() {
         char ver[6] = "00000";
 
@@ -609,7 +675,7 @@ void EEPROM::Postprocess() {
     	#if ENABLED(LIN_ADVANCE)
     	  EEPROM_WRITE(planner.extruder_advance_K);
     	#else
-    	  float k=0.0;
+    	  float k[DRIVER_EXTRUDERS] = { 0.0 };
     	  EEPROM_WRITE(k);
     	#endif
 
@@ -788,7 +854,7 @@ void EEPROM::Postprocess() {
 		    #if ENABLED(LIN_ADVANCE)
 		      EEPROM_READ(planner.extruder_advance_K);
 			#else
-			  EEPROM_READ(dummy);
+			  LOOP_EXTRUDERS(ie) EEPROM_READ(dummy);
 		    #endif
 
 		    //
@@ -824,6 +890,10 @@ void EEPROM::Postprocess() {
 
 
 			if (working_crc == stored_crc) {
+			  #if ENABLED(EG6_EXTRUDER)
+				// Stored by another printer variant or before a change of the limits
+				tools.check_switch_path();
+			  #endif
 			  #if ENABLED(EEPROM_CHITCHAT)
 				SERIAL_VAL(syscfg_version);
 				SERIAL_MV(" stored system settings retrieved (", eeprom_index - (EEPROM_OFFSET) - SYSCFG_OFFSET);
@@ -899,6 +969,13 @@ void EEPROM::Postprocess() {
           }
         #endif
 
+        #if ENABLED(PID_FEEDFORWARD)
+          LOOP_HOTEND() {
+            EEPROM_WRITE(heaters[h].Kf);
+            EEPROM_WRITE(heaters[h].Kl);
+          }
+        #endif
+
 
         if (!eeprom_error) {
           const int eeprom_size = eeprom_index;
@@ -997,6 +1074,13 @@ void EEPROM::Postprocess() {
             }
           #endif
 
+          #if ENABLED(PID_FEEDFORWARD)
+            LOOP_HOTEND() {
+              EEPROM_READ(heaters[h].Kf);
+              EEPROM_READ(heaters[h].Kl);
+            }
+          #endif
+
           #if HAS_EEPROM_SD
             // Read last two field
             uint16_t temp_crc;
@@ -1196,6 +1280,13 @@ void EEPROM::Postprocess() {
       EEPROM_WRITE(tools.lpq_len);
     #endif
 
+    #if ENABLED(PID_FEEDFORWARD)
+      LOOP_HOTEND() {
+        EEPROM_WRITE(heaters[h].Kf);
+        EEPROM_WRITE(heaters[h].Kl);
+      }
+    #endif
+
     #if ENABLED(DHT_SENSOR)
       EEPROM_WRITE(dhtsensor.pin);
       EEPROM_WRITE(dhtsensor.type);
@@ -1653,6 +1744,13 @@ void EEPROM::Postprocess() {
         EEPROM_READ(tools.lpq_len);
       #endif
 
+      #if ENABLED(PID_FEEDFORWARD)
+        LOOP_HOTEND() {
+          EEPROM_READ(heaters[h].Kf);
+          EEPROM_READ(heaters[h].Kl);
+        }
+      #endif
+
       #if ENABLED(DHT_SENSOR)
         EEPROM_READ(dhtsensor.pin);
         EEPROM_READ(dhtsensor.type);
@@ -2027,6 +2125,9 @@ void EEPROM::Factory_Settings() {
                         tmp7[] PROGMEM  = DEFAULT_Ki,
                         tmp8[] PROGMEM  = DEFAULT_Kd,
                         tmp9[] PROGMEM  = DEFAULT_Kc;
+  #if ENABLED(PID_FEEDFORWARD)
+    static const float  tmp_kf[] PROGMEM = DEFAULT_Kf;
+  #endif
 
   //SYS printerVersion = MACHINE_VERSION;
 
@@ -2146,6 +2247,10 @@ void EEPROM::Factory_Settings() {
         heat->Ki  = pgm_read_float(&tmp7[h < COUNT(tmp7) ? h : COUNT(tmp7) - 1]);
         heat->Kd  = pgm_read_float(&tmp8[h < COUNT(tmp8) ? h : COUNT(tmp8) - 1]);
         heat->Kc  = pgm_read_float(&tmp9[h < COUNT(tmp9) ? h : COUNT(tmp9) - 1]);
+        #if ENABLED(PID_FEEDFORWARD)
+          heat->Kf  = pgm_read_float(&tmp_kf[h < COUNT(tmp_kf) ? h : COUNT(tmp_kf) - 1]);
+          heat->Kl  = 0;
+        #endif
       }
     #endif
 
@@ -2439,7 +2544,7 @@ void EEPROM::Factory_Settings() {
   reset_stepper_drivers();
 
   #if ENABLED(LIN_ADVANCE)
-    planner.extruder_advance_K = LIN_ADVANCE_K;
+    LOOP_EXTRUDERS(ie) planner.extruder_advance_K[ie] = LIN_ADVANCE_K;
   #endif
 
   #if ENABLED(ADVANCED_PAUSE_FEATURE)
@@ -2521,13 +2626,7 @@ void EEPROM::Factory_Settings() {
 #endif
 
 #if ENABLED(EG6_EXTRUDER)
-    static const ToolSwitchPos tmp15[] PROGMEM = CHANGE_T0;
-    for (int i=0; i<CHANGE_MOVES; i++) tools.hotend_switch_path[0][i] = tmp15[i];
-
-	#if EXTRUDERS>1
-    	static const ToolSwitchPos tmp16[] PROGMEM = CHANGE_T1;
-        for (int i=0; i<CHANGE_MOVES; i++) tools.hotend_switch_path[1][i] = tmp16[i];
-	#endif
+    LOOP_HOTEND() tools.factory_switch_path(h);
 #endif
 
   tools.cut_servo_id = CUT_SERVO_ID;
@@ -2784,7 +2883,11 @@ void EEPROM::Factory_Settings() {
 			  */
 			#if ENABLED(LIN_ADVANCE)
 				CONFIG_MSG_HEADER(" Linear Advance:");
-				SERIAL_LV("M900 K", planner.extruder_advance_K);
+				LOOP_EXTRUDERS(ie) {
+				  CONFIG_MSG();
+				  SERIAL_MV("M900 D", (int)ie);
+				  SERIAL_EMV(" K", planner.extruder_advance_K[ie]);
+				}
 			#endif
 
 
@@ -80,6 +80,11 @@ class EEPROM {
 		  static bool Store_Const();
 		  static bool Load_Const();
 
+		  #if HOTENDS > 1
+		    static bool Store_Stats();
+		    static bool Load_Stats();
+		  #endif
+
 		  static bool Store_Sys();
 		  static bool Load_Sys();
 		  static uint16_t stored_sys_crc;
@@ -45,11 +45,20 @@
     // Reset valor
     soft_pwm               = 0;
     pwm_pos                = 0;
+    #if HARDWARE_PWM && HEATER_PWM_RESOLUTION > 8
+      pwm_hr               = 0;
+    #endif
+    #if HARDWARE_PWM && ENABLED(HEATER_PWM_DITHER)
+      pwm_dither           = 0;
+    #endif
     target_temperature     = 0;
     target_temp_nocorr     = 0;
     temperature_correction = 0;
     current_temperature    = 25.0;
     sensor.raw             = 0;
+    #if HEATER_USES_MAX
+      sensor.reset_spi();
+    #endif
     last_temperature       = 0.0;
     temperature_1s         = 0.0;
     consecutive_error_temp = 0;
@@ -163,7 +172,11 @@
         soft_pwm = 0;
       else {
         float pidTerm = Kp * difference;
-        tempIState = constrain(tempIState + difference, tempIStateLimitMin, tempIStateLimitMax);
+        #if ENABLED(HEATER_POWER_BUDGET)
+          // Cut by the power budget, more integral would only wind up
+          if (!isPowerLimited() || difference < 0)
+        #endif
+            tempIState = constrain(tempIState + difference, tempIStateLimitMin, tempIStateLimitMax);
         pidTerm += Ki * tempIState * 0.1; // 0.1 = 10Hz
         float dgain = Kd * (last_temperature - temperature_1s);
         pidTerm += dgain;
@@ -183,7 +196,16 @@
           }
         #endif // PID_ADD_EXTRUSION_RATE
 
-        soft_pwm = constrain((int)pidTerm, 0, PID_MAX);
+        #if ENABLED(PID_FEEDFORWARD)
+          if (type == IS_HOTEND)
+            pidTerm += Kl * (target_temperature - 25) + Kf * planner.hotend_flow[ID];
+        #endif
+
+        #if HARDWARE_PWM && HEATER_PWM_RESOLUTION > 8
+          setPwmHr(constrain(pidTerm, 0, PID_MAX) * (HEATER_PWM_MAX / 255.0f));
+        #else
+          soft_pwm = constrain((int)pidTerm, 0, PID_MAX);
+        #endif
       }
 
       if (cycle_1s) {
@@ -222,6 +244,12 @@
       #if ENABLED(PID_ADD_EXTRUSION_RATE)
         SERIAL_MV(" C", Kc);
       #endif
+      #if ENABLED(PID_FEEDFORWARD)
+        if (type == IS_HOTEND) {
+          SERIAL_MV(" F", Kf);
+          SERIAL_MV(" A", Kl);
+        }
+      #endif
       SERIAL_EOL();
     }
   }
@@ -287,14 +315,30 @@
 
   #if HARDWARE_PWM
     void Heater::SetHardwarePwm() {
-      uint8_t pwm_val = 0;
 
-      if (isHWInverted())
-        pwm_val = 255 - soft_pwm;
-      else
-        pwm_val = soft_pwm;
+      #if HEATER_PWM_RESOLUTION > 8
+        // When soft_pwm was set by someone else (bang-bang, autotune, power budget) its value is used
+        uint32_t pwm_val = (pwm_hr * 255UL + HEATER_PWM_MAX - 1) / HEATER_PWM_MAX == soft_pwm
+                            ? pwm_hr
+                            : soft_pwm * HEATER_PWM_MAX / 255UL;
+      #else
+        uint32_t pwm_val = soft_pwm;
+      #endif
+
+      if (isHWInverted()) pwm_val = HEATER_PWM_MAX - pwm_val;
+
+      #if ENABLED(HEATER_PWM_DITHER)
+        // Without PWM or timer, switch every ms so the mean is the duty
+        if (!USEABLE_HARDWARE_PWM(pin)) {
+          const uint32_t sum = pwm_dither + pwm_val;
+          const bool on = sum >= HEATER_PWM_MAX;
+          pwm_dither = on ? sum - HEATER_PWM_MAX : sum;
+          OUT_WRITE(pin, on);
+          return;
+        }
+      #endif
 
-      HAL::analogWrite(pin, pwm_val, (type == IS_HOTEND) ? 250 : 10);
+      HAL::analogWrite(pin, pwm_val, (type == IS_HOTEND) ? 250 : 10, HEATER_PWM_RESOLUTION);
     }
   #endif
 
@@ -45,7 +45,8 @@
     heater_flag_use_pid,
     heater_flag_tuning,
     heater_flag_hardware_inverted,
-    heater_flag_idle
+    heater_flag_idle,
+    heater_flag_power_limited
   };
 
   typedef enum { IS_HOTEND = 0, IS_BED = 1, IS_CHAMBER = 2, IS_COOLER = 3 } Heater_type;
@@ -85,6 +86,19 @@
       uint8_t     HeaterFlag;
       uint8_t     consecutive_error_temp;
 
+      #if ENABLED(PID_FEEDFORWARD)
+        float     Kf,   // Power per mm3/s of plastic
+                  Kl;   // Power per degree over 25C, fitted by M303
+      #endif
+
+      #if HARDWARE_PWM && HEATER_PWM_RESOLUTION > 8
+        uint16_t  pwm_hr;       // Duty at HEATER_PWM_RESOLUTION bits, soft_pwm is it rounded up to 8 bits
+      #endif
+
+      #if HARDWARE_PWM && ENABLED(HEATER_PWM_DITHER)
+        uint16_t  pwm_dither;   // Duty left over by the last ms
+      #endif
+
       #if HEATER_IDLE_HANDLER
         millis_l  idle_timeout_ms;
       #endif
@@ -116,6 +130,13 @@
         void SetHardwarePwm();
       #endif
 
+      #if HARDWARE_PWM && HEATER_PWM_RESOLUTION > 8
+        FORCE_INLINE void setPwmHr(const uint16_t duty) {
+          pwm_hr = duty;
+          soft_pwm = (duty * 255UL + HEATER_PWM_MAX - 1) / HEATER_PWM_MAX;
+        }
+      #endif
+
       FORCE_INLINE void updateCurrentTemperature() {
     	  float new_temperature = this->sensor.getTemperature();
     	  if ((new_temperature < this->mintemp) || (new_temperature > this->maxtemp+MAXTEMP_ERROR_THRESHOLD))
@@ -165,6 +186,11 @@
       }
       FORCE_INLINE bool isIdle() { return TEST(HeaterFlag, heater_flag_idle); }
 
+      FORCE_INLINE void setPowerLimited(const bool onoff) {
+        SET_BIT(HeaterFlag, heater_flag_power_limited, onoff);
+      }
+      FORCE_INLINE bool isPowerLimited() { return TEST(HeaterFlag, heater_flag_power_limited); }
+
       FORCE_INLINE bool resetFlag() { HeaterFlag = 0; }
 
       #if HEATER_IDLE_HANDLER
@@ -48,4 +48,11 @@
   #endif
 #endif
 
+#if HEATER_PWM_RESOLUTION < 8 || HEATER_PWM_RESOLUTION > 16
+  #error "DEPENDENCY ERROR: HEATER_PWM_RESOLUTION must be between 8 and 16."
+#endif
+#if HEATER_PWM_RESOLUTION > 8 && !ENABLED(ARDUINO_ARCH_SAM)
+  #error "DEPENDENCY ERROR: HEATER_PWM_RESOLUTION over 8 needs the hardware PWM of the Arduino Due."
+#endif
+
 #endif /* _HEATER_SANITYCHECK_H_ */
@@ -145,46 +145,6 @@ void setWires(max31865_numwires_t wires , const pin_t cs_pin) {
   writeRegister8(MAX31856_CONFIG_REG, t, cs_pin);
 }*/
 
-void clearFault(const pin_t cs_pin) {
-  uint8_t t = readRegister8(MAX31856_CONFIG_REG, cs_pin);
-  t &= ~0x2C;
-  t |= MAX31856_CONFIG_FAULTSTAT;
-  writeRegister8(MAX31856_CONFIG_REG, t, cs_pin);
-}
-
-uint8_t readFault(const pin_t cs_pin) {
-  return readRegister8(MAX31856_FAULTSTAT_REG, cs_pin);
-}
-
-bool readRTD (uint16_t &rtd, const pin_t cs_pin) {
-
-  uint8_t r0 = readRegister8(MAX31856_CONFIG_REG, cs_pin);
-  rtd = readRegister16(MAX31856_RTDMSB_REG, cs_pin);
-
-  if ((rtd & 1) != 0)										// if fault bit set
-  {
-	  uint8_t f = readFault(cs_pin);
-	  Serial.print("R0:");
-	  Serial.println(r0, HEX);
-	  Serial.print("RTD:");
-	  Serial.println(rtd, HEX);
-	  Serial.print("F:");
-	  Serial.println(f, HEX);
-	  if (f & 0x04) SERIAL_LV(PSTR("MAX31856 error - over/undervoltage - "), cs_pin);
-	  else if (f & 0x13) SERIAL_LV(PSTR("MAX31856 error - open circuit - "), cs_pin);
-	  else if (f & 0x40) SERIAL_LV(PSTR("MAX31856 error - RDT low resistance - "), cs_pin);
-	  else SERIAL_LV(PSTR("MAX31856 hardware error - "), cs_pin);
-	  clearFault(cs_pin);
-	  rtd >>= 1;
-	  return true;
-	  //return false;
-  }
-
-  // remove fault
-  rtd >>= 1;
-  return true;
-}
-
 }
 
 
@@ -219,7 +179,39 @@ bool MAX31865::Initialize(max31865_numwires_t wires, const pin_t cs_pin) {
 	return true;
 }
 
-float MAX31865::ReadTemperature(const pin_t cs_pin) {
+/**
+ * Read the last conversion, false when the fault bit is set.
+ * The chip converts continuously, so this is a single short SPI transfer.
+ */
+bool MAX31865::ReadRTD(const pin_t cs_pin, uint16_t &rtd) {
+	rtd = readRegister16(MAX31856_RTDMSB_REG, cs_pin);
+	const bool fault = rtd & 1;
+	rtd >>= 1;
+	return !fault;
+}
+
+uint8_t MAX31865::ReadFault(const pin_t cs_pin) {
+	return readRegister8(MAX31856_FAULTSTAT_REG, cs_pin);
+}
+
+void MAX31865::ReportFault(const pin_t cs_pin, const uint8_t fault) {
+	if (fault & 0x04) SERIAL_LV(PSTR("MAX31856 error - over/undervoltage - "), cs_pin);
+	else if (fault & 0x13) SERIAL_LV(PSTR("MAX31856 error - open circuit - "), cs_pin);
+	else if (fault & 0x40) SERIAL_LV(PSTR("MAX31856 error - RDT low resistance - "), cs_pin);
+	else SERIAL_LV(PSTR("MAX31856 hardware error - "), cs_pin);
+}
+
+void MAX31865::ClearFault(const pin_t cs_pin) {
+	uint8_t t = readRegister8(MAX31856_CONFIG_REG, cs_pin);
+	t &= ~0x2C;
+	t |= MAX31856_CONFIG_FAULTSTAT;
+	writeRegister8(MAX31856_CONFIG_REG, t, cs_pin);
+}
+
+/**
+ * Convert a RTD reading to degC
+ */
+float MAX31865::Temperature(const uint16_t rtd) {
 	  // http://www.analog.com/media/en/technical-documentation/application-notes/AN709_0.pdf
 
 	  float RTDnominal = RTD_RNOMINAL;
@@ -227,9 +219,6 @@ float MAX31865::ReadTemperature(const pin_t cs_pin) {
 
 	  float Z1, Z2, Z3, Z4, Rt, temp;
 
-	  uint16_t rtd;
-	  if (!readRTD(rtd, cs_pin)) return 1000;
-
 	  Rt = rtd;
 	  Rt /= 32768;
 	  Rt *= refResistor;
@@ -87,10 +87,17 @@ typedef enum max31865_numwires {
 const uint8_t DefaultCr0 = 0b11000011;
 const uint8_t Cr0ReadMask = 0b11011101;
 
+// Interval between the readings, the continuous conversion takes about 21ms
+#define MAX31865_READ_INTERVAL  100
+
 namespace MAX31865 {
 
 	bool Initialize(max31865_numwires_t wires, const pin_t cs_pin);
-	float ReadTemperature(const pin_t cs_pin);
+	bool ReadRTD(const pin_t cs_pin, uint16_t &rtd);
+	uint8_t ReadFault(const pin_t cs_pin);
+	void ReportFault(const pin_t cs_pin, const uint8_t fault);
+	void ClearFault(const pin_t cs_pin);
+	float Temperature(const uint16_t rtd);
 }
 
 #endif
@@ -62,6 +62,30 @@
   #endif
 #endif
 
+// Thermistor table
+#if HAS_THERMISTOR_TABLE
+  #if !WITHIN(THERMISTOR_TABLE_SIZE, 32, 1024) || (THERMISTOR_TABLE_SIZE & (THERMISTOR_TABLE_SIZE - 1))
+    #error "DEPENDENCY ERROR: THERMISTOR_TABLE_SIZE must be a power of 2 between 32 and 1024."
+  #endif
+#endif
+
+// ADC pipeline
+#if ENABLED(ARDUINO_ARCH_SAM)
+  #if DISABLED(ADC_HOTEND_RATE) || DISABLED(ADC_BED_RATE) || DISABLED(ADC_CHAMBER_RATE) || DISABLED(ADC_AUX_RATE)
+    #error "DEPENDENCY ERROR: Missing setting ADC_HOTEND_RATE, ADC_BED_RATE, ADC_CHAMBER_RATE or ADC_AUX_RATE."
+  #elif !WITHIN(ADC_HOTEND_RATE, 1, 255) || !WITHIN(ADC_BED_RATE, 1, 255) || !WITHIN(ADC_CHAMBER_RATE, 1, 255) || !WITHIN(ADC_AUX_RATE, 1, 255)
+    #error "DEPENDENCY ERROR: ADC_HOTEND_RATE, ADC_BED_RATE, ADC_CHAMBER_RATE and ADC_AUX_RATE must be between 1 and 255."
+  #endif
+  #if DISABLED(ADC_HOTEND_AVERAGE) || DISABLED(ADC_BED_AVERAGE) || DISABLED(ADC_CHAMBER_AVERAGE) || DISABLED(ADC_AUX_AVERAGE)
+    #error "DEPENDENCY ERROR: Missing setting ADC_HOTEND_AVERAGE, ADC_BED_AVERAGE, ADC_CHAMBER_AVERAGE or ADC_AUX_AVERAGE."
+  #elif !WITHIN(ADC_HOTEND_AVERAGE, 1, 32) || (ADC_HOTEND_AVERAGE & (ADC_HOTEND_AVERAGE - 1)) \
+     || !WITHIN(ADC_BED_AVERAGE, 1, 32) || (ADC_BED_AVERAGE & (ADC_BED_AVERAGE - 1)) \
+     || !WITHIN(ADC_CHAMBER_AVERAGE, 1, 32) || (ADC_CHAMBER_AVERAGE & (ADC_CHAMBER_AVERAGE - 1)) \
+     || !WITHIN(ADC_AUX_AVERAGE, 1, 32) || (ADC_AUX_AVERAGE & (ADC_AUX_AVERAGE - 1))
+    #error "DEPENDENCY ERROR: ADC_HOTEND_AVERAGE, ADC_BED_AVERAGE, ADC_CHAMBER_AVERAGE and ADC_AUX_AVERAGE must be a power of 2 between 1 and 32."
+  #endif
+#endif
+
 // Every hotend needs a temp sensor
 #if HOTENDS > 0
   #if TEMP_SENSOR_0 == 0
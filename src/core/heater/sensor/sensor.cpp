@@ -28,20 +28,13 @@
 
 #if ENABLED(SUPPORT_MAX6675)
 
-  #define MAX6675_HEAT_INTERVAL 250u
+  #define MAX6675_HEAT_INTERVAL 250u  // Reading during the 220ms conversion restarts it
   #define MAX6675_ERROR_MASK      4
   #define MAX6675_DISCARD_BITS    3
 
   int16_t TemperatureSensor::read_max6675(const pin_t cs_pin) {
 
-    static millis_t next_max6675_ms = 0;
-    static uint16_t max6675_temp = 2000;
-
-    millis_t ms = millis();
-
-    if (PENDING(ms, next_max6675_ms)) return (int)max6675_temp;
-
-    next_max6675_ms = ms + MAX6675_HEAT_INTERVAL;
+    uint16_t max6675_temp;
 
     #if ENABLED(CPU_32_BIT)
       HAL::spiBegin();
@@ -96,7 +89,8 @@
 
 #if ENABLED(SUPPORT_MAX31855)
 
-  #define MAX31855_DISCARD_BITS 18
+  #define MAX31855_READ_INTERVAL 100u // Conversion time of the MAX31855
+  #define MAX31855_DISCARD_BITS   18
 
   int16_t TemperatureSensor::read_max31855(const pin_t cs_pin) {
 
@@ -145,17 +139,10 @@ float TemperatureSensor::getTemperature() {
   const int16_t s_type      = type,
                 adcReading  = raw;
 
-  #if ENABLED(SUPPORT_MAX31865)
-	if (s_type == -4)
-	  return MAX31865::ReadTemperature(pin);
-  #endif
-  #if ENABLED(SUPPORT_MAX31855)
-    if (s_type == -3)
-      return 0.25 * read_max31855(pin);
-  #endif
-  #if ENABLED(SUPPORT_MAX6675)
-    if (s_type == -2)
-      return 0.25 * read_max6675(pin);
+  #if HEATER_USES_MAX
+    // Sampled in the background by spin_spi()
+    if (WITHIN(s_type, -4, -2))
+      return spi_temperature;
   #endif
   #if HEATER_USES_AD595
     if (s_type == -1)
@@ -164,29 +151,18 @@ float TemperatureSensor::getTemperature() {
 
 
   if (WITHIN(s_type, 1, 9)) {
-    const int32_t averagedVssaReading = 2 * adcLowOffset,
-                  averagedVrefReading = AD_RANGE + 2 * adcHighOffset;
-
-    // Calculate the resistance
-    const float denom = (float)(averagedVrefReading - adcReading) - 0.5;
-    if (denom <= 0.0) return ABS_ZERO;
-
-    const float resistance = pullupR * ((float)(adcReading - averagedVssaReading) + 0.5) / denom;
-    const float logResistance = LOG(resistance);
-    const float recipT = shA + shB * logResistance + shC * logResistance * logResistance * logResistance;
-
-    /*
-    SERIAL_MV("Debug denom:", denom, 5);
-    SERIAL_MV(" resistance:", resistance, 5);
-    SERIAL_MV(" logResistance:", logResistance, 5);
-    SERIAL_MV(" shA:", shA, 5);
-    SERIAL_MV(" shB:", shB, 5);
-    SERIAL_MV(" shC:", shC, 5);
-    SERIAL_MV(" recipT:", recipT, 5);
-    SERIAL_EOL();
-    */
-
-    return (recipT > 0.0) ? (1.0 / recipT) + (ABS_ZERO) : 2000.0;
+    #if HAS_THERMISTOR_TABLE
+      // Linear interpolation between the two table steps around the reading
+      if (adcReading <= 0) return table[0] * 0.0625f;
+      if (adcReading >= AD_RANGE) return table[THERMISTOR_TABLE_SIZE] * 0.0625f;
+      const int32_t pos   = int32_t(adcReading) * (THERMISTOR_TABLE_SIZE),
+                    index = pos / (AD_RANGE),
+                    frac  = pos - index * (AD_RANGE),
+                    t0    = table[index];
+      return (t0 * (AD_RANGE) + (table[index + 1] - t0) * frac) * (0.0625f / (AD_RANGE));
+    #else
+      return thermistor_temperature(adcReading);
+    #endif
   }
 
   #if ENABLED(DHT_SENSOR)
@@ -226,6 +202,71 @@ float TemperatureSensor::getTemperature() {
   return 25;
 }
 
+#if HEATER_USES_MAX
+
+  void TemperatureSensor::reset_spi() {
+    spi_temperature = ABS_ZERO;   // No reading yet
+    spi_fault = false;
+    spi_watch.stop();
+  }
+
+  /**
+   * Background sampling of the SPI sensors, called from the idle loop.
+   * Does at most one SPI transaction, when the chip has a new conversion
+   * ready, and keeps the result for getTemperature(). Returns true if the
+   * bus was used.
+   */
+  bool TemperatureSensor::spin_spi() {
+
+    switch (type) {
+
+      #if ENABLED(SUPPORT_MAX31865)
+        case -4:
+          // A fault is reported and cleared on the next call
+          if (spi_fault) {
+            MAX31865::ReportFault(pin, MAX31865::ReadFault(pin));
+            MAX31865::ClearFault(pin);
+            spi_fault = false;
+            return true;
+          }
+          if (spi_watch.elapsed(MAX31865_READ_INTERVAL)) {
+            uint16_t rtd;
+            spi_fault = !MAX31865::ReadRTD(pin, rtd);
+            spi_temperature = MAX31865::Temperature(rtd);
+            spi_watch.start();
+            return true;
+          }
+          break;
+      #endif
+
+      #if ENABLED(SUPPORT_MAX31855)
+        case -3:
+          if (spi_watch.elapsed(MAX31855_READ_INTERVAL)) {
+            spi_temperature = 0.25 * read_max31855(pin);
+            spi_watch.start();
+            return true;
+          }
+          break;
+      #endif
+
+      #if ENABLED(SUPPORT_MAX6675)
+        case -2:
+          if (spi_watch.elapsed(MAX6675_HEAT_INTERVAL)) {
+            spi_temperature = 0.25 * read_max6675(pin);
+            spi_watch.start();
+            return true;
+          }
+          break;
+      #endif
+
+      default: break;
+    }
+
+    return false;
+  }
+
+#endif // HEATER_USES_MAX
+
 void TemperatureSensor::CalcDerivedParameters() {
 	shB = 1.0 / beta;
 	const float lnR25 = LOG(r25);
@@ -238,4 +279,44 @@ void TemperatureSensor::CalcDerivedParameters() {
   SERIAL_EMV(" shB:", shB, 15);
   SERIAL_EMV(" shC:", shC, 15);
   */
+
+  #if HAS_THERMISTOR_TABLE
+    // Rebuilt on every parameter change, the readings only interpolate it
+    if (WITHIN(type, 1, 9)) {
+      for (uint16_t i = 0; i <= THERMISTOR_TABLE_SIZE; i++) {
+        const float t = thermistor_temperature(int32_t(i) * (AD_RANGE) / (THERMISTOR_TABLE_SIZE));
+        table[i] = LROUND(constrain(t, ABS_ZERO, 2000.0) * 16.0);
+      }
+    }
+  #endif
+}
+
+/**
+ * Steinhart-Hart conversion of a thermistor reading
+ */
+float TemperatureSensor::thermistor_temperature(const int16_t adcReading) {
+
+  const int32_t averagedVssaReading = 2 * adcLowOffset,
+                averagedVrefReading = AD_RANGE + 2 * adcHighOffset;
+
+  // Calculate the resistance
+  const float denom = (float)(averagedVrefReading - adcReading) - 0.5;
+  if (denom <= 0.0) return ABS_ZERO;
+
+  const float resistance = pullupR * ((float)(adcReading - averagedVssaReading) + 0.5) / denom;
+  const float logResistance = LOG(resistance);
+  const float recipT = shA + shB * logResistance + shC * logResistance * logResistance * logResistance;
+
+  /*
+  SERIAL_MV("Debug denom:", denom, 5);
+  SERIAL_MV(" resistance:", resistance, 5);
+  SERIAL_MV(" logResistance:", logResistance, 5);
+  SERIAL_MV(" shA:", shA, 5);
+  SERIAL_MV(" shB:", shB, 5);
+  SERIAL_MV(" shC:", shC, 5);
+  SERIAL_MV(" recipT:", recipT, 5);
+  SERIAL_EOL();
+  */
+
+  return (recipT > 0.0) ? (1.0 / recipT) + (ABS_ZERO) : 2000.0;
 }
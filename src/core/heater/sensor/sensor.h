@@ -50,13 +50,33 @@ class TemperatureSensor {
             ad595_gain;
     #endif
 
+  private: /** Private Parameters */
+
+    #if HAS_THERMISTOR_TABLE
+      // Temperature in 1/16 degC at every AD_RANGE / THERMISTOR_TABLE_SIZE step of the reading
+      int16_t table[THERMISTOR_TABLE_SIZE + 1];
+    #endif
+
+    #if HEATER_USES_MAX
+      float   spi_temperature;  // Last conversion of a SPI sensor, read by getTemperature()
+      watch_t spi_watch;        // Time of the last conversion read
+      bool    spi_fault;        // A MAX31865 fault is waiting to be reported and cleared
+    #endif
+
   public: /** Public Function */
 
     void CalcDerivedParameters();
     float getTemperature();
 
+    #if HEATER_USES_MAX
+      void reset_spi();
+      bool spin_spi();
+    #endif
+
   private: /** Private Function */
 
+    float thermistor_temperature(const int16_t adcReading);
+
     #if ENABLED(SUPPORT_MAX6675)
       int16_t read_max6675(const pin_t cs_pin);
     #endif
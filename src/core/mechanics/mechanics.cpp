@@ -228,22 +228,42 @@ void Mechanics::prepare_move_to_destination() {
  *  The final current_position may not be the one that was requested
  */
 void Mechanics::do_blocking_move_to(const float rx, const float ry, const float rz, const float &fr_mm_s /*=0.0*/) {
-  const float old_feedrate_mm_s = feedrate_mm_s;
 
   #if ENABLED(DEBUG_LEVELING_FEATURE)
     if (printer.debugLeveling()) print_xyz(PSTR(">>> do_blocking_move_to"), NULL, rx, ry, rz);
   #endif
 
+  queue_move_to(rx, ry, rz, fr_mm_s);
+
+  stepper.synchronize();
+
+  #if ENABLED(DEBUG_LEVELING_FEATURE)
+    if (printer.debugLeveling()) SERIAL_EM("<<< do_blocking_move_to");
+  #endif
+}
+
+/**
+ * Same moves of do_blocking_move_to, left in the planner.
+ * Consecutive calls are joined by the look-ahead.
+ * Return the seconds of the moves at their feedrate.
+ */
+float Mechanics::queue_move_to(const float rx, const float ry, const float rz, const float &fr_mm_s/*=0.0*/) {
+  const float old_feedrate_mm_s = feedrate_mm_s;
+
   const float z_feedrate = fr_mm_s ? fr_mm_s : homing_feedrate_mm_s[Z_AXIS];
 
+  float time = 0.0;
+
   // If Z needs to raise, do it before moving XY
   if (current_position[Z_AXIS] < rz) {
     feedrate_mm_s = z_feedrate;
+    time += (rz - current_position[Z_AXIS]) / feedrate_mm_s;
     current_position[Z_AXIS] = rz;
     line_to_current_position();
   }
 
   feedrate_mm_s = fr_mm_s ? fr_mm_s : XY_PROBE_FEEDRATE_MM_S;
+  time += HYPOT(rx - current_position[X_AXIS], ry - current_position[Y_AXIS]) / feedrate_mm_s;
   current_position[X_AXIS] = rx;
   current_position[Y_AXIS] = ry;
   line_to_current_position();
@@ -251,17 +271,14 @@ void Mechanics::do_blocking_move_to(const float rx, const float ry, const float
   // If Z needs to lower, do it after moving XY
   if (current_position[Z_AXIS] > rz) {
     feedrate_mm_s = z_feedrate;
+    time += (current_position[Z_AXIS] - rz) / feedrate_mm_s;
     current_position[Z_AXIS] = rz;
     line_to_current_position();
   }
 
-  stepper.synchronize();
-
   feedrate_mm_s = old_feedrate_mm_s;
 
-  #if ENABLED(DEBUG_LEVELING_FEATURE)
-    if (printer.debugLeveling()) SERIAL_EM("<<< do_blocking_move_to");
-  #endif
+  return time;
 }
 void Mechanics::do_blocking_move_to_x(const float &rx, const float &fr_mm_s/*=0.0*/) {
   mechanics.do_blocking_move_to(rx, current_position[Y_AXIS], current_position[Z_AXIS], fr_mm_s);
@@ -326,6 +326,14 @@ class Mechanics {
     static  void do_blocking_move_to_z(const float &rz, const float &fr_mm_s=0.0);
     static  void do_blocking_move_to_xy(const float &rx, const float &ry, const float &fr_mm_s=0.0);
 
+    /**
+     * Plan the moves of do_blocking_move_to without waiting for them.
+     * Straight lines with no kinematics, so Cartesian and Core only
+     * outside the base do_blocking_move_to (EG6_EXTRUDER is checked in
+     * tools/sanitycheck.h). Return their time at the feedrate.
+     */
+    static  float queue_move_to(const float rx, const float ry, const float rz, const float &fr_mm_s=0.0);
+
     /**
      * sync_plan_position
      *
@@ -349,6 +357,7 @@ class Mechanics {
      * Home an individual linear axis
      */
     virtual void do_homing_move(const AxisEnum axis, const float distance, const float fr_mm_s=0.0);
+    static float get_homing_bump_feedrate(const AxisEnum axis);
 
     /**
      * Report current position to host
@@ -429,8 +438,6 @@ class Mechanics {
 
     static void report_xyze(const float pos[], const uint8_t n=XYZE, const uint8_t precision=3);
 
-    static float get_homing_bump_feedrate(const AxisEnum axis);
-
 };
 
 #if IS_CARTESIAN
@@ -80,6 +80,10 @@ volatile uint8_t  Planner::block_buffer_head = 0, // Index of the next block to
   bool Planner::autotemp_enabled = false;
 #endif
 
+#if ENABLED(PID_FEEDFORWARD)
+  float Planner::hotend_flow[HOTENDS] = { 0.0 };
+#endif
+
 int32_t Planner::position[NUM_AXIS] = { 0 };
 
 uint32_t Planner::cutoff_long;
@@ -99,8 +103,8 @@ float Planner::previous_speed[NUM_AXIS],
 #endif
 
 #if ENABLED(LIN_ADVANCE)
-  float Planner::extruder_advance_K   = LIN_ADVANCE_K,
-        Planner::position_float[XYZE] = { 0.0 };
+  float Planner::extruder_advance_K[DRIVER_EXTRUDERS] = ARRAY_BY_EXTRUDERS(LIN_ADVANCE_K),
+        Planner::position_float[XYZE]                 = { 0.0 };
 #endif
 
 #if ENABLED(ULTRA_LCD)
@@ -799,6 +803,23 @@ void Planner::forward_pass() {
   forward_pass_kernel(block[1], block[2]);
 }
 
+#if ENABLED(LIN_ADVANCE)
+
+  /**
+   * Advance steps of every extruder driver with advance in the block,
+   * at the cruising speed and at the exit speed.
+   */
+  void Planner::calculate_advance_for_block(block_t* const block, const float &exit_speed) {
+    LOOP_EXTRUDERS(ie) {
+      if (!TEST(block->use_advance_lead, ie)) continue;
+      const float comp = block->e_D_ratio[ie] * extruder_advance_K[ie] * mechanics.axis_steps_per_mm[XYZ + ie];
+      block->max_adv_steps[ie] = block->nominal_speed * comp;
+      block->final_adv_steps[ie] = exit_speed * comp;
+    }
+  }
+
+#endif
+
 /**
  * Recalculate the trapezoid speed profiles for all blocks in the plan
  * according to the entry_factor for each junction. Must be called by
@@ -818,11 +839,7 @@ void Planner::recalculate_trapezoids() {
         const float nomr = 1.0 / current->nominal_speed;
         calculate_trapezoid_for_block(current, current->entry_speed * nomr, next->entry_speed * nomr);
         #if ENABLED(LIN_ADVANCE)
-          if (current->use_advance_lead) {
-            const float comp = current->e_D_ratio * extruder_advance_K * mechanics.axis_steps_per_mm[E_AXIS];
-            current->max_adv_steps = current->nominal_speed * comp;
-            current->final_adv_steps = next->entry_speed * comp;
-          }
+          if (current->use_advance_lead) calculate_advance_for_block(current, next->entry_speed);
         #endif
         CBI(current->flag, BLOCK_BIT_RECALCULATE); // Reset current only to ensure next trapezoid is computed
       }
@@ -834,11 +851,7 @@ void Planner::recalculate_trapezoids() {
     const float nomr = 1.0 / next->nominal_speed;
     calculate_trapezoid_for_block(next, next->entry_speed * nomr, (MINIMUM_PLANNER_SPEED) * nomr);
     #if ENABLED(LIN_ADVANCE)
-      if (next->use_advance_lead) {
-        const float comp = next->e_D_ratio * extruder_advance_K * mechanics.axis_steps_per_mm[E_AXIS];
-        next->max_adv_steps = next->nominal_speed * comp;
-        next->final_adv_steps = (MINIMUM_PLANNER_SPEED) * comp;
-      }
+      if (next->use_advance_lead) calculate_advance_for_block(next, MINIMUM_PLANNER_SPEED);
     #endif
     CBI(next->flag, BLOCK_BIT_RECALCULATE);
   }
@@ -911,6 +924,52 @@ void Planner::recalculate() {
 
 #endif // HAS_TEMP_HOTEND && ENABLED(AUTOTEMP)
 
+#if ENABLED(PID_FEEDFORWARD)
+
+  /**
+   * Plastic flow of each hotend (mm3/s), averaged over the
+   * next PID_FEEDFORWARD_TIME ms of the queued moves.
+   * Travel moves count as time, retracts and moves
+   * of the extruders alone are not flow.
+   */
+  void Planner::update_hotend_flow() {
+
+    const uint8_t driver_hotend[] = DRIVER_EXTRUDERS_HOTENDS,
+                  plastic_driver[] = PLASTIC_DRIVER_EXTRUDERS;
+    constexpr float horizon = (PID_FEEDFORWARD_TIME) * 0.001;
+
+    float area[DRIVER_EXTRUDERS], volume[HOTENDS] = { 0.0 }, time = 0.0;
+
+    LOOP_EXTRUDERS(d) {
+      #if ENABLED(VOLUMETRIC_EXTRUSION)
+        const float diameter = tools.filament_size[d] ? tools.filament_size[d] : DEFAULT_NOMINAL_FILAMENT_DIA;
+      #else
+        constexpr float diameter = DEFAULT_NOMINAL_FILAMENT_DIA;
+      #endif
+      area[d] = CIRCLE_AREA(diameter * 0.5) * mechanics.steps_to_mm[XYZ + d];
+    }
+
+    for (uint8_t b = block_buffer_tail; b != block_buffer_head && time < horizon; b = next_block_index(b)) {
+      const block_t * const block = &block_buffer[b];
+      if (block->nominal_speed <= 0) continue;
+
+      const float block_time  = block->millimeters / block->nominal_speed,
+                  part        = block_time > horizon - time ? (horizon - time) / block_time : 1.0;
+      time += part * block_time;
+
+      if (!block->steps[X_AXIS] && !block->steps[Y_AXIS] && !block->steps[Z_AXIS]) continue;
+
+      LOOP_EXTRUDERS(d) {
+        if (plastic_driver[d] && driver_hotend[d] < HOTENDS && block->steps[XYZ + d] && !TEST(block->direction_bits, XYZ + d))
+          volume[driver_hotend[d]] += part * block->steps[XYZ + d] * area[d];
+      }
+    }
+
+    LOOP_HOTEND() hotend_flow[h] = time > 0 ? volume[h] / time : 0.0;
+  }
+
+#endif // PID_FEEDFORWARD
+
 /**
  * Maintain fans, paste extruder pressure,
  */
@@ -1172,6 +1231,16 @@ void Planner::check_axes_activity() {
   	  if (esteps[ie]) extruder_moves = true;
     }
 
+    // Fiber fed with XY motion, the stepper ISR marks the fiber as no more cut
+    if (tools.printing_with_fiber && (block->steps[X_AXIS] || block->steps[Y_AXIS])) {
+      LOOP_EXTRUDERS(ie) {
+        if (esteps[ie] && !tools.extruder_driver_is_plastic(AxisEnum(E_AXIS + ie))) {
+          SBI(block->flag, BLOCK_BIT_FIBER_FEED);
+          break;
+        }
+      }
+    }
+
 
   block->step_event_count = MAX4(block->steps[X_AXIS], block->steps[Y_AXIS], block->steps[Z_AXIS], max_esteps);
 
@@ -1673,7 +1742,7 @@ void Planner::check_axes_activity() {
 		}
 	}
     #if ENABLED(LIN_ADVANCE)
-      block->use_advance_lead = false;
+      block->use_advance_lead = 0;
     #endif
   }
   else {
@@ -1708,41 +1777,59 @@ void Planner::check_axes_activity() {
     #if ENABLED(LIN_ADVANCE)
       /**
        *
-       * Use LIN_ADVANCE for blocks if all these are true:
+       * Use LIN_ADVANCE on an extruder driver of the block if all these are true:
        *
-       * esteps[0]          : This is a print move, because we checked for A, B, C steps before. Only E is taken into account.
+       * esteps[ie]             : This is a print move, because we checked for A, B, C steps before.
        *
-       * extruder_advance_K : There is an advance factor set.
+       * plastic driver         : The fiber is not compressed, only the plastic drivers have advance.
        *
-       * de > 0             : Extruder is running forward (e.g., for "Wipe while retracting" (Slic3r) or "Combing" (Cura) moves)
+       * extruder_advance_K[ie] : There is an advance factor set for the driver.
+       *
+       * de[ie] > 0             : Extruder is running forward (e.g., for "Wipe while retracting" (Slic3r) or "Combing" (Cura) moves)
+       *
+       * The plastic and the fiber drivers run together in the same block, so every
+       * plastic driver gets its own pressure, and the driver with the most advance
+       * leads the advance ISR.
        */
-      block->use_advance_lead =  esteps[0]
-                              && extruder_advance_K
-                              && de > 0;
-
-      if (block->use_advance_lead) {
-        block->e_D_ratio = (target_float[E_AXIS] - position_float[E_AXIS]) /
-          #if IS_KINEMATIC
-            block->millimeters
-          #else
-            SQRT(sq(target_float[X_AXIS] - position_float[X_AXIS])
-               + sq(target_float[Y_AXIS] - position_float[Y_AXIS])
-               + sq(target_float[Z_AXIS] - position_float[Z_AXIS]))
-          #endif
-        ;
+      block->use_advance_lead = 0;
+      block->advance_lead = 0;
+
+      const float travel =
+        #if IS_KINEMATIC
+          block->millimeters
+        #else
+          SQRT(sq(target_float[X_AXIS] - position_float[X_AXIS])
+             + sq(target_float[Y_AXIS] - position_float[Y_AXIS])
+             + sq(target_float[Z_AXIS] - position_float[Z_AXIS]))
+        #endif
+      ;
+
+      float lead_comp = 0.0;
+
+      LOOP_EXTRUDERS(ie) {
+        if (!esteps[ie] || !extruder_advance_K[ie] || de[ie] <= 0 || !tools.extruder_driver_is_plastic(AxisEnum(XYZ + ie))) continue;
+
+        const float e_D_ratio = (target_float[XYZ + ie] - position_float[XYZ + ie]) / travel;
 
         // Check for unusual high e_D ratio to detect if a retract move was combined with the last print move due to min. steps per segment. Never execute this with advance!
         // This assumes no one will use a retract length of 0mm < retr_length < ~0.2mm and no one will print 100mm wide lines using 3mm filament or 35mm wide lines using 1.75mm filament.
-        if (block->e_D_ratio > 3.0)
-          block->use_advance_lead = false;
-        else {
-          const uint32_t max_accel_steps_per_s2 = mechanics.max_jerk[E_AXIS] / (extruder_advance_K * block->e_D_ratio) * steps_per_mm;
-          #if ENABLED(LA_DEBUG)
-            if (accel > max_accel_steps_per_s2)
-              SERIAL_EM("Acceleration limited.");
-          #endif
-          NOMORE(accel, max_accel_steps_per_s2);
+        if (e_D_ratio > 3.0) continue;
+
+        block->e_D_ratio[ie] = e_D_ratio;
+        SBI(block->use_advance_lead, ie);
+
+        const float comp = e_D_ratio * extruder_advance_K[ie] * mechanics.axis_steps_per_mm[XYZ + ie];
+        if (comp > lead_comp) {
+          lead_comp = comp;
+          block->advance_lead = ie;
         }
+
+        const uint32_t max_accel_steps_per_s2 = mechanics.max_jerk[XYZ + ie] / (extruder_advance_K[ie] * e_D_ratio) * steps_per_mm;
+        #if ENABLED(LA_DEBUG)
+          if (accel > max_accel_steps_per_s2)
+            SERIAL_EM("Acceleration limited.");
+        #endif
+        NOMORE(accel, max_accel_steps_per_s2);
       }
     #endif
 
@@ -1764,9 +1851,11 @@ void Planner::check_axes_activity() {
   #endif
   #if ENABLED(LIN_ADVANCE)
     if (block->use_advance_lead) {
-      block->advance_speed = (HAL_TIMER_RATE) / (extruder_advance_K * block->e_D_ratio * block->acceleration * mechanics.axis_steps_per_mm[E_AXIS]);
+      // The lead driver needs the fastest advance ISR, the others follow it
+      const uint8_t lead = block->advance_lead;
+      block->advance_speed = (HAL_TIMER_RATE) / (extruder_advance_K[lead] * block->e_D_ratio[lead] * block->acceleration * mechanics.axis_steps_per_mm[XYZ + lead]);
       #if ENABLED(LA_DEBUG)
-        if (extruder_advance_K * block->e_D_ratio * block->acceleration * 2 < block->nominal_speed * block->e_D_ratio)
+        if (extruder_advance_K[lead] * block->e_D_ratio[lead] * block->acceleration * 2 < block->nominal_speed * block->e_D_ratio[lead])
           SERIAL_EM("More than 2 steps per eISR loop executed.");
         if (block->advance_speed < 200)
           SERIAL_EM("eISR running at > 10kHz.");
@@ -1855,6 +1944,12 @@ void Planner::check_axes_activity() {
     vmax_junction = safe_speed;
   }
 
+  // The fiber is cut with the head at rest
+  if (moves_queued && TEST(block_buffer[prev_block_index(block_buffer_head)].flag, BLOCK_BIT_FIBER_CUT)) {
+    SBI(block->flag, BLOCK_BIT_START_FROM_FULL_HALT);
+    vmax_junction = 0;
+  }
+
   // Max entry speed of this block equals the max exit speed of the previous block.
   block->max_entry_speed = vmax_junction;
 
@@ -48,7 +48,13 @@ enum BlockFlagBit {
   BLOCK_BIT_BUSY,
 
   // The block is segment 2+ of a longer move
-  BLOCK_BIT_CONTINUED
+  BLOCK_BIT_CONTINUED,
+
+  // Cut the fiber when the block is done
+  BLOCK_BIT_FIBER_CUT,
+
+  // The block feeds the fiber together with XY motion
+  BLOCK_BIT_FIBER_FEED
 };
 
 enum BlockFlag {
@@ -56,7 +62,9 @@ enum BlockFlag {
   BLOCK_FLAG_NOMINAL_LENGTH       = _BV(BLOCK_BIT_NOMINAL_LENGTH),
   BLOCK_FLAG_START_FROM_FULL_HALT = _BV(BLOCK_BIT_START_FROM_FULL_HALT),
   BLOCK_FLAG_BUSY                 = _BV(BLOCK_BIT_BUSY),
-  BLOCK_FLAG_CONTINUED            = _BV(BLOCK_BIT_CONTINUED)
+  BLOCK_FLAG_CONTINUED            = _BV(BLOCK_BIT_CONTINUED),
+  BLOCK_FLAG_FIBER_CUT            = _BV(BLOCK_BIT_FIBER_CUT),
+  BLOCK_FLAG_FIBER_FEED           = _BV(BLOCK_BIT_FIBER_FEED)
 };
 
 /**
@@ -100,11 +108,12 @@ typedef struct {
 
   // Advance extrusion
   #if ENABLED(LIN_ADVANCE)
-    bool      use_advance_lead;
+    uint8_t   use_advance_lead,             // Extruder drivers with advance, a bit for each one
+              advance_lead;                 // Driver with the most advance, it sets the advance_speed
     uint16_t  advance_speed,                // Timer value for extruder speed offset
-              max_adv_steps,                // max. advance steps to get cruising speed pressure (not always nominal_speed!)
-              final_adv_steps;              // advance steps due to exit speed
-    float     e_D_ratio;
+              max_adv_steps[DRIVER_EXTRUDERS],    // max. advance steps to get cruising speed pressure (not always nominal_speed!)
+              final_adv_steps[DRIVER_EXTRUDERS];  // advance steps due to exit speed
+    float     e_D_ratio[DRIVER_EXTRUDERS];
   #endif
 
   // Fields used by the motion planner to manage acceleration
@@ -175,7 +184,7 @@ class Planner {
     static uint32_t cutoff_long;
 
     #if ENABLED(LIN_ADVANCE)
-      static float  extruder_advance_K,
+      static float  extruder_advance_K[DRIVER_EXTRUDERS],
                     position_float[XYZE];
     #endif
 
@@ -341,6 +350,19 @@ class Planner {
       return discard;
     }
 
+    /**
+     * Cut the fiber at the end of the last queued block.
+     * Return false if the buffer is empty.
+     */
+    static bool set_fiber_cut() {
+      bool queued;
+      CRITICAL_SECTION_START
+        if ((queued = has_blocks_queued()))
+          SBI(block_buffer[prev_block_index(block_buffer_head)].flag, BLOCK_BIT_FIBER_CUT);
+      CRITICAL_SECTION_END
+      return queued;
+    }
+
     FORCE_INLINE void add_block_length(uint16_t block_len) {
       if (block_buffer_head != block_buffer_tail)
         block_buffer[prev_block_index(block_buffer_head)].block_len += block_len;
@@ -408,6 +430,11 @@ class Planner {
       static void autotemp_M104_M109();
     #endif
 
+    #if ENABLED(PID_FEEDFORWARD)
+      static float hotend_flow[HOTENDS];
+      static void update_hotend_flow();
+    #endif
+
   private: /** Private Function */
 
     /**
@@ -458,6 +485,10 @@ class Planner {
 
     static void calculate_trapezoid_for_block(block_t* const block, const float &entry_factor, const float &exit_factor);
 
+    #if ENABLED(LIN_ADVANCE)
+      static void calculate_advance_for_block(block_t* const block, const float &exit_speed);
+    #endif
+
     static void reverse_pass_kernel(block_t* const current, const block_t * const next);
     static void forward_pass_kernel(const block_t * const previous, block_t* const current);
 
@@ -26,6 +26,14 @@ PrintCounter print_job_counter;
 
 printStatistics PrintCounter::data;
 
+#if HOTENDS > 1
+  toolStatistics PrintCounter::toolJob;
+#endif
+
+float   PrintCounter::jobExtruded[DRIVER_EXTRUDERS] = { 0.0 },
+        PrintCounter::spoolLeft[DRIVER_EXTRUDERS]   = ARRAY_BY_EXTRUDERS(-1.0);
+uint8_t PrintCounter::spoolWarned                   = 0;
+
 const uint16_t  PrintCounter::updateInterval  = 10,
                 PrintCounter::saveInterval    = (SD_CFG_SECONDS);
 
@@ -47,7 +55,10 @@ void PrintCounter::initStats() {
     PrintCounter::debug(PSTR("initStats"));
   #endif
 
-  data = { 0, 0, 0, 0, 0.0 };
+  data.totalPrints = data.finishedPrints = 0;
+  data.printTime = data.printer_usage = 0;
+  LOOP_EXTRUDERS(d) data.filamentUsed[d] = 0.0;
+  // data.toolLife is kept in its own EEPROM block, only M158 R resets it
 }
 
 void PrintCounter::loadStats() {
@@ -105,6 +116,141 @@ void PrintCounter::showStats() {
   SERIAL_EMT("Filament used: ", buffer);
 }
 
+#if HOTENDS > 1
+
+  static void add_tool_time(uint32_t &count, uint32_t &total, const millis_l time) {
+    count++;
+    total += time;
+  }
+
+  void PrintCounter::toolChange(const uint8_t tool, const millis_l time) {
+    if (tool >= HOTENDS) return;
+    add_tool_time(toolJob.changes[tool], toolJob.changeTime[tool], time);
+    add_tool_time(data.toolLife.changes[tool], data.toolLife.changeTime[tool], time);
+    NOLESS(toolJob.changeMax[tool], time);
+    NOLESS(data.toolLife.changeMax[tool], time);
+  }
+
+  void PrintCounter::toolCut(const millis_l time) {
+    add_tool_time(toolJob.cuts, toolJob.cutTime, time);
+    add_tool_time(data.toolLife.cuts, data.toolLife.cutTime, time);
+  }
+
+  void PrintCounter::toolPark(const millis_l time) {
+    add_tool_time(toolJob.parks, toolJob.parkTime, time);
+    add_tool_time(data.toolLife.parks, data.toolLife.parkTime, time);
+  }
+
+  static void print_tool_stats(const char * const label, const toolStatistics &stats) {
+    SERIAL_MSG(MSG_STATS);
+    SERIAL_PS(label);
+    LOOP_HOTEND() {
+      SERIAL_MV(" T", (int)h);
+      SERIAL_MV(":", stats.changes[h]);
+      SERIAL_MV(" avg:", stats.changes[h] ? stats.changeTime[h] / stats.changes[h] : (uint32_t)0);
+      SERIAL_MV("ms max:", stats.changeMax[h]);
+      SERIAL_MSG("ms");
+    }
+    SERIAL_MV(" Cuts:", stats.cuts);
+    SERIAL_MV(" avg:", stats.cuts ? stats.cutTime / stats.cuts : (uint32_t)0);
+    SERIAL_MV("ms Parks:", stats.parks);
+    SERIAL_MV(" avg:", stats.parks ? stats.parkTime / stats.parks : (uint32_t)0);
+    SERIAL_EM("ms");
+  }
+
+  void PrintCounter::showToolStats() {
+    print_tool_stats(PSTR("Job tool changes"), toolJob);
+    print_tool_stats(PSTR("Life tool changes"), data.toolLife);
+  }
+
+  void PrintCounter::resetToolStats() {
+    memset(&data.toolLife, 0, sizeof(data.toolLife));
+    #if HAS_EEPROM && ENABLED(EEPROM_MULTIPART)
+      eeprom.Store_Stats();
+    #endif
+  }
+
+#endif // HOTENDS > 1
+
+// Called by the scheduler, every second
+void PrintCounter::updateExtruded() {
+
+  LOOP_EXTRUDERS(d) {
+    const int32_t steps = stepper.take_extruded_steps(d);
+    if (!steps) continue;
+    const float mm = steps * mechanics.steps_to_mm[E_AXIS + d];
+    if (isRunning() || isPaused()) jobExtruded[d] += mm;
+    if (spoolLeft[d] >= 0) {
+      spoolLeft[d] -= mm;
+      NOLESS(spoolLeft[d], 0.0);
+    }
+  }
+
+  if (!isRunning()) return;
+
+  LOOP_EXTRUDERS(d) {
+    if (spoolLeft[d] < 0 || TEST(spoolWarned, d)) continue;
+    const float need = neededExtruded(d);
+    if (need > spoolLeft[d]) {
+      SBI(spoolWarned, d);
+      SERIAL_SMV(ECHO, "Spool D", (int)d);
+      SERIAL_MV(" will run out, left:", spoolLeft[d] * 0.001, 2);
+      SERIAL_EMV("m needed:", need * 0.001, 2);
+    }
+  }
+}
+
+void PrintCounter::setSpool(const uint8_t d, const float mm) {
+  updateExtruded();
+  spoolLeft[d] = mm < 0 ? -1.0 : mm;
+  CBI(spoolWarned, d);
+}
+
+float PrintCounter::jobMaterial(const bool plastic) {
+  float mm = 0.0;
+  LOOP_EXTRUDERS(d)
+    if (tools.extruder_driver_is_plastic(AxisEnum(E_AXIS + d)) == plastic) mm += jobExtruded[d];
+  return mm;
+}
+
+float PrintCounter::expectedExtruded(const uint8_t d) {
+  #if HAS_SDSUPPORT
+    const int8_t h = tools.extruder_driver_to_extruder(d);
+    if (h < 0 || h >= HOTENDS || !card.isFileOpen()) return 0.0;
+    if (tools.extruder_driver_is_plastic(AxisEnum(E_AXIS + d))) {
+      #if ENABLED(VOLUMETRIC_EXTRUSION)
+        const float diameter = tools.filament_size[d] ? tools.filament_size[d] : DEFAULT_NOMINAL_FILAMENT_DIA;
+      #else
+        constexpr float diameter = DEFAULT_NOMINAL_FILAMENT_DIA;
+      #endif
+      // g to mm3, then to mm of filament
+      return card.fileInfo.ExtruderInfo[h].PlasticConsumption * 1000.0 / (PLASTIC_DENSITY) / CIRCLE_AREA(diameter * 0.5);
+    }
+    return card.fileInfo.ExtruderInfo[h].FiberConsumption * 1000.0;
+  #else
+    UNUSED(d);
+    return 0.0;
+  #endif
+}
+
+void PrintCounter::showExtruded() {
+  LOOP_EXTRUDERS(d) {
+    SERIAL_SMV(ECHO, "D", (int)d);
+    SERIAL_MSG(tools.extruder_driver_is_plastic(AxisEnum(E_AXIS + d)) ? " plastic" : " fiber");
+    SERIAL_MV(" job:", jobExtruded[d] * 0.001, 2);
+    SERIAL_MV("m expected:", expectedExtruded(d) * 0.001, 2);
+    SERIAL_MSG("m spool left:");
+    if (spoolLeft[d] >= 0) {
+      SERIAL_VAL(spoolLeft[d] * 0.001, 2);
+      SERIAL_CHR('m');
+    }
+    else
+      SERIAL_MSG("unknown");
+    if (isRunning() && spoolLeft[d] >= 0) SERIAL_MV(" needed:", neededExtruded(d) * 0.001, 2);
+    SERIAL_EOL();
+  }
+}
+
 void PrintCounter::tick() {
 
   static millis_l update_last = millis(),
@@ -148,6 +294,13 @@ bool PrintCounter::start() {
     if (!paused) {
       data.totalPrints++;
       lastDuration = 0;
+      #if HOTENDS > 1
+        memset(&toolJob, 0, sizeof(toolJob));
+      #endif
+      // What was extruded before the job goes to the spools only
+      updateExtruded();
+      ZERO(jobExtruded);
+      spoolWarned = 0;
     }
     return true;
   }
@@ -163,6 +316,9 @@ bool PrintCounter::stop() {
     data.finishedPrints++;
     data.printTime += deltaDuration();
     saveStats();
+    #if HOTENDS > 1 && HAS_EEPROM && ENABLED(EEPROM_MULTIPART)
+      eeprom.Store_Stats();
+    #endif
     return true;
   }
   else return false;
@@ -178,6 +334,17 @@ void PrintCounter::reset() {
 }
 
 
+/**
+ * Private Function
+ */
+float PrintCounter::neededExtruded(const uint8_t d) {
+  // The file info, or the extrusion so far at the progress of the job, the larger one
+  float need = expectedExtruded(d) - jobExtruded[d];
+  if (printer.progress >= 5)
+    NOLESS(need, jobExtruded[d] * (100 - printer.progress) / printer.progress);
+  return need > 0 ? need : 0.0;
+}
+
 #if ENABLED(DEBUG_PRINTCOUNTER)
 
   void PrintCounter::debug(const char func[]) {
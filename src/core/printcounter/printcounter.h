@@ -28,12 +28,27 @@
 
 //#define DEBUG_PRINTCOUNTER
 
+#if HOTENDS > 1
+  struct toolStatistics {
+    uint32_t  changes[HOTENDS],     // Changes to each tool
+              changeTime[HOTENDS],  // ms spent changing to each tool
+              changeMax[HOTENDS],   // ms of the longest change to each tool
+              cuts,                 // Fiber cuts
+              cutTime,              // ms spent cutting the fiber
+              parks,                // Parks at the wipe position
+              parkTime;             // ms of the moves to the wipe position, planner estimate
+  };
+#endif
+
 struct printStatistics {
   uint16_t  totalPrints;    // Number of prints
   uint16_t  finishedPrints; // Number of complete prints
   uint32_t  printTime;      // Accumulated printing time
   uint32_t  printer_usage;  // Printer usage ON
   double    filamentUsed[DRIVER_EXTRUDERS];   // Accumulated filament consumed in mm
+  #if HOTENDS > 1
+    toolStatistics toolLife; // Tool changes of the printer life, kept in EEPROM
+  #endif
 };
 
 class PrintCounter: public Stopwatch {
@@ -42,6 +57,13 @@ class PrintCounter: public Stopwatch {
 
     static printStatistics data;
 
+    #if HOTENDS > 1
+      static toolStatistics toolJob;  // Tool changes of the current or last job
+    #endif
+
+    static float  jobExtruded[DRIVER_EXTRUDERS],  // mm extruded by each driver in the current or last job
+                  spoolLeft[DRIVER_EXTRUDERS];    // mm left on each spool, below 0 unknown
+
     /**
      * @brief Stats were loaded from SDCARD
      * @details If set to true it indicates if the statistical data was already
@@ -53,6 +75,8 @@ class PrintCounter: public Stopwatch {
 
     typedef Stopwatch super;
 
+    static uint8_t spoolWarned;  // Drivers already warned of the spool running out
+
   public: /** Public Function */
 
     /**
@@ -96,6 +120,57 @@ class PrintCounter: public Stopwatch {
      */
     static void tick();
 
+    #if HOTENDS > 1
+
+      /**
+       * @brief Tool change accounting
+       * @details Add a tool change, a fiber cut or a park at the wipe position,
+       * with its duration in ms, to the job and to the life statistics.
+       */
+      static void toolChange(const uint8_t tool, const millis_l time);
+      static void toolCut(const millis_l time);
+      static void toolPark(const millis_l time);
+
+      /**
+       * @brief Serial output the tool change statistics of the job and of the life
+       */
+      static void showToolStats();
+
+      /**
+       * @brief Resets the life tool change statistics
+       */
+      static void resetToolStats();
+
+    #endif
+
+    /**
+     * @brief Extrusion accounting
+     * @details Takes the steps of the blocks done by the stepper into the job
+     * and the spools of each extruder driver, then warns once per driver when
+     * the spool will not last to the end of the job.
+     */
+    static void updateExtruded();
+
+    /**
+     * @brief Sets the mm left on the spool of an extruder driver, below 0 unknown
+     */
+    static void setSpool(const uint8_t d, const float mm);
+
+    /**
+     * @brief mm extruded in the job by the plastic or by the fiber drivers
+     */
+    static float jobMaterial(const bool plastic);
+
+    /**
+     * @brief mm the file info expects from an extruder driver, 0 unknown
+     */
+    static float expectedExtruded(const uint8_t d);
+
+    /**
+     * @brief Serial output the extrusion of the job and the spools left
+     */
+    static void showExtruded();
+
     /**
      * The following functions are being overridden
      */
@@ -135,6 +210,11 @@ class PrintCounter: public Stopwatch {
      */
     static millis_l lastDuration;
 
+    /**
+     * @brief mm an extruder driver still needs to the end of the job, 0 unknown
+     */
+    static float neededExtruded(const uint8_t d);
+
   protected: /** Protected Parameters */
 
     /**
@@ -181,6 +181,9 @@ void Printer::setup() {
   watchdog.init();
 
   eeprom.Load_Const();
+  #if HOTENDS > 1 && HAS_EEPROM && ENABLED(EEPROM_MULTIPART)
+    eeprom.Load_Stats();
+  #endif
   SERIAL_LM(ECHO, CUSTOM_MACHINE_NAME);
   SERIAL_LMV(ECHO, "VER:", eeprom.printerVersion);
   SERIAL_LMV(ECHO, "SN:", eeprom.printerSN);
@@ -225,6 +228,12 @@ void Printer::setup() {
 
   thermalManager.init();  // Initialize temperature loop
 
+  #if HAS_HOTEND_STANDBY
+    standby.init();
+  #endif
+
+  scheduler.init();       // Start the periodic tasks
+
   stepper.init(); // Initialize stepper, this enables interrupts!
 
   #if MB(ALLIGATOR) || MB(ALLIGATOR_V3)
@@ -355,7 +364,7 @@ void Printer::loop() {
 
       #if HAS_SD_RESTART
         // Save Job for restart
-        if (card.cardOK && IS_SD_PRINTING) restart.save_data(true);
+        if (card.cardOK && IS_SD_PRINTING) restart.save_job(true);
       #endif
 
       // Stop SD printing
@@ -407,57 +416,17 @@ void Printer::loop() {
 
 void Printer::check_periodical_actions() {
 
-  static uint8_t  cycle_1000ms = 10,  // Event 1.0 Second
-                  cycle_2500ms = 25;  // Event 2.5 Second
-
   // Control interrupt events
   handle_interrupt_events();
 
   // Tick timer job counter
   print_job_counter.tick();
 
-  // Event 100 Ms - 10Hz
-  if (HAL::execute_100ms) {
-    HAL::execute_100ms = false;
-    planner.check_axes_activity();
-    thermalManager.spin();
-
-    /*Serial.print("Commands:");
-    Serial.print(commands.buffer_lenght);
-    Serial.print(" - Moves:");
-    Serial.print(planner.movesplanned());
-    Serial.print(" - Pause:");
-    Serial.println(PrintPause::Status);*/
-
-    // Event 1.0 Second
-    if (--cycle_1000ms == 0) {
-      cycle_1000ms = 10;
-      if (!isSuspendAutoreport() && isAutoreportTemp()) {
-        thermalManager.report_temperatures();
-        SERIAL_EOL();
-      }
-      #if HAS_SDSUPPORT
-        if (isAutoreportSD()) card.printStatus();
-      #endif
-      #if ENABLED(NEXTION)
-        nextion_draw_update();
-      #endif
-	  #if ENABLED(NEXTION_HMI)
-		NextionHMI::DrawUpdate();
-	  #endif
-    }
+  // The AVR HAL keeps the new ADC values until the 100ms flag is cleared
+  HAL::execute_100ms = false;
 
-    // Event 2.5 Second
-    if (--cycle_2500ms == 0) {
-      cycle_2500ms = 25;
-      #if FAN_COUNT > 0
-        LOOP_FAN() fans[f].spin();
-      #endif
-      #if HAS_POWER_SWITCH
-        powerManager.spin();
-      #endif
-    }
-  }
+  // Temperature, motion, reports, fans, power and runout at their own rates
+  scheduler.spin();
 
 }
 
@@ -646,12 +615,12 @@ void Printer::idle(const bool ignore_stepper_queue/*=false*/) {
     dhtsensor.spin();
   #endif
 
-  #if ENABLED(CNCROUTER)
-    cnc.manage();
+  #if HEATER_USES_MAX
+    thermalManager.spin_spi_sensors();
   #endif
 
-  #if HAS_FIL_RUNOUT
-    filamentrunout.spin();
+  #if ENABLED(CNCROUTER)
+    cnc.manage();
   #endif
 
   #if ENABLED(FLOWMETER_SENSOR)
@@ -0,0 +1,191 @@
+/**
+ * MK4duo Firmware for 3D Printer, Laser and CNC
+ *
+ * Based on Marlin, Sprinter and grbl
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ * Copyright (C) 2013 Alberto Cotronei @MagoKimbra
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../MK4duo.h"
+
+Scheduler scheduler;
+
+/**
+ * Tasks
+ */
+static void task_temperature() { thermalManager.spin(); }
+
+static void task_motion() { planner.check_axes_activity(); }
+
+static void task_fiber() { tools.fiber_spin(); }
+
+static void task_extrusion() { print_job_counter.updateExtruded(); }
+
+static void task_report() {
+  if (!printer.isSuspendAutoreport() && printer.isAutoreportTemp()) {
+    thermalManager.report_temperatures();
+    SERIAL_EOL();
+  }
+  #if HAS_SDSUPPORT
+    if (printer.isAutoreportSD()) card.printStatus();
+  #endif
+  #if ENABLED(NEXTION)
+    nextion_draw_update();
+  #endif
+  #if ENABLED(NEXTION_HMI)
+    NextionHMI::DrawUpdate();
+  #endif
+}
+
+#if FAN_COUNT > 0
+  static void task_fans() { LOOP_FAN() fans[f].spin(); }
+#endif
+
+#if HAS_POWER_SWITCH
+  static void task_power() { powerManager.spin(); }
+#endif
+
+#if HAS_FIL_RUNOUT
+  static void task_runout() { filamentrunout.spin(); }
+#endif
+
+#if HAS_HOTEND_STANDBY
+  static void task_standby() { standby.spin(); }
+#endif
+
+#if ENABLED(NEXTION_HMI)
+  static void task_pause() { PrintPause::Spin(); }
+#endif
+
+#if HAS_SWITCH_TEST
+  static void task_switchtest() { switchtest.spin(); }
+#endif
+
+const char task_temperature_name[] PROGMEM  = "temperature";
+const char task_motion_name[] PROGMEM       = "motion";
+const char task_report_name[] PROGMEM       = "report";
+const char task_fiber_name[] PROGMEM        = "fiber";
+const char task_extrusion_name[] PROGMEM    = "extrusion";
+#if FAN_COUNT > 0
+  const char task_fans_name[] PROGMEM       = "fans";
+#endif
+#if HAS_POWER_SWITCH
+  const char task_power_name[] PROGMEM      = "power";
+#endif
+#if HAS_FIL_RUNOUT
+  const char task_runout_name[] PROGMEM     = "runout";
+#endif
+#if HAS_HOTEND_STANDBY
+  const char task_standby_name[] PROGMEM    = "standby";
+#endif
+#if ENABLED(NEXTION_HMI)
+  const char task_pause_name[] PROGMEM      = "pause";
+#endif
+#if HAS_SWITCH_TEST
+  const char task_switchtest_name[] PROGMEM = "switchtest";
+#endif
+
+// Name, function, period (ms), deadline (ms)
+task_t Scheduler::tasks[] = {
+  { task_temperature_name,  task_temperature,  100,  20 },
+  { task_motion_name,       task_motion,       100,  50 },
+  { task_report_name,       task_report,      1000, 500 },
+  { task_fiber_name,        task_fiber,        100, 100 },
+  { task_extrusion_name,    task_extrusion,   1000, 500 },
+  #if FAN_COUNT > 0
+    { task_fans_name,       task_fans,        2500, 500 },
+  #endif
+  #if HAS_POWER_SWITCH
+    { task_power_name,      task_power,       2500, 500 },
+  #endif
+  #if HAS_FIL_RUNOUT
+    { task_runout_name,     task_runout,        10,  10 },
+  #endif
+  #if HAS_HOTEND_STANDBY
+    { task_standby_name,    task_standby,      500, 500 },
+  #endif
+  #if ENABLED(NEXTION_HMI)
+    { task_pause_name,      task_pause,         20, 100 },
+  #endif
+  #if HAS_SWITCH_TEST
+    { task_switchtest_name, task_switchtest,   100, 500 },
+  #endif
+};
+
+/**
+ * Public Function
+ */
+void Scheduler::init() {
+  const millis_l now = millis();
+  for (uint8_t t = 0; t < COUNT(tasks); t++) tasks[t].next_ms = now + tasks[t].period;
+  reset_stats();
+}
+
+void Scheduler::spin() {
+
+  for (uint8_t t = 0; t < COUNT(tasks); t++) {
+
+    task_t &task = tasks[t];
+
+    const millis_l now = millis();
+    if (PENDING(now, task.next_ms)) continue;
+
+    const millis_l late = now - task.next_ms;
+    if (late > task.deadline) task.overruns++;
+    if (late > task.max_late) task.max_late = late > 0xFFFF ? 0xFFFF : late;
+
+    // Stay on the grid, drop the periods already gone
+    task.next_ms += task.period;
+    if (ELAPSED(now, task.next_ms)) {
+      const uint32_t missed = (now - task.next_ms) / task.period + 1;
+      task.skipped += missed;
+      task.next_ms += missed * task.period;
+    }
+
+    const uint32_t start = micros();
+    task.run();
+    const uint32_t time = micros() - start;
+
+    task.runs++;
+    task.total_time += time;
+    NOLESS(task.max_time, time);
+  }
+
+}
+
+void Scheduler::report() {
+  for (uint8_t t = 0; t < COUNT(tasks); t++) {
+    const task_t &task = tasks[t];
+    SERIAL_STR(ECHO);
+    SERIAL_PS(task.name);
+    SERIAL_MV(" P", task.period);
+    SERIAL_MV(" runs:", task.runs);
+    SERIAL_MV(" avg:", task.runs ? task.total_time / task.runs : (uint32_t)0);
+    SERIAL_MV("us max:", task.max_time);
+    SERIAL_MV("us late:", task.max_late);
+    SERIAL_MV("ms overruns:", task.overruns);
+    SERIAL_EMV(" skipped:", task.skipped);
+  }
+}
+
+void Scheduler::reset_stats() {
+  for (uint8_t t = 0; t < COUNT(tasks); t++) {
+    task_t &task = tasks[t];
+    task.runs = task.overruns = task.skipped = task.total_time = task.max_time = 0;
+    task.max_late = 0;
+  }
+}
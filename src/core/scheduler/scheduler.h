@@ -0,0 +1,71 @@
+/**
+ * MK4duo Firmware for 3D Printer, Laser and CNC
+ *
+ * Based on Marlin, Sprinter and grbl
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ * Copyright (C) 2013 Alberto Cotronei @MagoKimbra
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * scheduler.h - Fixed rate tasks of the main loop
+ *
+ * Every task has a period and a deadline, and runs from idle() when its
+ * time comes. The next start stays on the same time grid, so a late call
+ * does not shift the following ones. A start later than the deadline is
+ * an overrun, and whole periods already gone are skipped, not caught up.
+ * M157 reports the timing of each task.
+ */
+
+#ifndef _SCHEDULER_H_
+#define _SCHEDULER_H_
+
+typedef struct {
+  PGM_P     name;
+  void      (*run)();
+  uint16_t  period,       // ms
+            deadline;     // ms of delay before a start is an overrun
+  millis_l  next_ms;
+  uint32_t  runs,
+            overruns,
+            skipped,
+            total_time,   // us
+            max_time;     // us
+  uint16_t  max_late;     // ms
+} task_t;
+
+class Scheduler {
+
+  public: /** Constructor */
+
+    Scheduler() {}
+
+  private: /** Private Parameters */
+
+    static task_t tasks[];
+
+  public: /** Public Function */
+
+    static void init();
+    static void spin();
+    static void report();
+    static void reset_stats();
+
+};
+
+extern Scheduler scheduler;
+
+#endif /* _SCHEDULER_H_ */
@@ -81,6 +81,14 @@ watch_t Stepper::move_watch(DEFAULT_STEPPER_DEACTIVE_TIME * 1000UL);
 
 int16_t Stepper::cleaning_buffer_counter = 0;
 
+#if HAS_SERVOS
+  volatile bool Stepper::fiber_cut_pending = false;
+  millis_l      Stepper::fiber_cut_start_ms = 0,
+                Stepper::fiber_cut_end_ms = 0;
+#endif
+
+volatile int32_t Stepper::extruded_steps[DRIVER_EXTRUDERS] = { 0 };
+
 // private:
 
 uint16_t Stepper::last_direction_bits = 0;        // The next stepping-bits to be output
@@ -137,14 +145,15 @@ volatile uint32_t Stepper::step_events_completed = 0; // The number of step even
               Stepper::nextAdvanceISR = ADV_NEVER,
               Stepper::eISR_Rate      = ADV_NEVER;
 
-  uint16_t    Stepper::current_adv_steps  = 0,
-              Stepper::final_adv_steps    = 0,
-              Stepper::max_adv_steps      = 0;
+  uint16_t    Stepper::current_adv_steps[DRIVER_EXTRUDERS]  = { 0 },
+              Stepper::final_adv_steps[DRIVER_EXTRUDERS]    = { 0 },
+              Stepper::max_adv_steps[DRIVER_EXTRUDERS]      = { 0 };
 
-  int8_t      Stepper::e_steps            = 0,
-              Stepper::LA_active_extruder = 0;  // Copy from current executed block. Needed because current_block is set to NULL "too early".
+  int8_t      Stepper::e_steps[DRIVER_EXTRUDERS]            = { 0 };
 
-  bool        Stepper::use_advance_lead   = false;
+  uint8_t     Stepper::LA_drivers       = 0,
+              Stepper::LA_lead_driver   = 0,  // Copy from current executed block. Needed because current_block is set to NULL "too early".
+              Stepper::use_advance_lead = 0;
 
 #endif // LIN_ADVANCE
 
@@ -417,16 +426,15 @@ void Stepper::set_directions() {
 
   #if HAS_EXTRUDERS
 
-	#if DISABLED(LIN_ADVANCE)
-		if (motor_direction(E_AXIS)) {
-		  REV_E_DIR();
-		  count_direction[E_AXIS] = -1;
-		}
-		else {
-		  NORM_E_DIR();
-		  count_direction[E_AXIS] = 1;
-		}
-	#endif
+	// With LIN_ADVANCE the advance ISR sets the pin again before its steps
+	if (motor_direction(E_AXIS)) {
+	  REV_E_DIR();
+	  count_direction[E_AXIS] = -1;
+	}
+	else {
+	  NORM_E_DIR();
+	  count_direction[E_AXIS] = 1;
+	}
 
 	#if DRIVER_EXTRUDERS > 1
 		if (motor_direction(U_AXIS)) {  // -direction
@@ -1396,36 +1404,44 @@ void Stepper::isr() {
   // If there is no current block, attempt to pop one from the buffer
   if (!current_block) {
 
+    #if HAS_SERVOS
+      // Hold the next block until the blade has cut, then open it during the move
+      if (fiber_cut_pending) {
+        if (PENDING(millis(), fiber_cut_end_ms)) {
+          _NEXT_ISR(HAL_TIMER_RATE / 1000); // Run at slow speed - 1 KHz
+          return;
+        }
+        servo[tools.cut_servo_id].write(tools.cut_neutral_angle);
+        tools.fiber_cut_opened(millis() - fiber_cut_start_ms);
+        tools.fiber_cut_done();
+        fiber_cut_pending = false;
+      }
+    #endif
+
     // Anything in the buffer?
     if ((current_block = planner.get_current_block())) {
 
       // Initialize the trapezoid generator from the current block.
       static int8_t last_extruder = -1;
 
-      if (tools.printing_with_fiber && tools.fiber_is_cut)
-      {
-          bool moveXY = (current_block->steps[X_AXIS]>0) || (current_block->steps[Y_AXIS]>0);
-          bool move_fiber = false;
-          const int plastic_driver_extruders[] = PLASTIC_DRIVER_EXTRUDERS;
-          LOOP_EUVW(i)
-          {
-        	  if (plastic_driver_extruders[i-XYZ] == 0 && current_block->steps[i]>0) move_fiber = true;
-          }
-          if (moveXY && move_fiber) tools.fiber_is_cut = false;
-      }
+      if (TEST(current_block->flag, BLOCK_BIT_FIBER_FEED)) tools.fiber_feed_start();
 
       #if ENABLED(LIN_ADVANCE)
         #if EXTRUDERS > 1
           if (current_block->active_extruder != last_extruder) {
-            current_adv_steps = 0; // If the now active extruder wasn't in use during the last move, its pressure is most likely gone.
-            LA_active_extruder = current_block->active_extruder;
+            // If the now active extruder wasn't in use during the last move, the pressure of its drivers is most likely gone.
+            LOOP_EXTRUDERS(d)
+              if (tools.extruder_driver_to_extruder(d) == current_block->active_extruder) current_adv_steps[d] = 0;
           }
         #endif
 
         if ((use_advance_lead = current_block->use_advance_lead)) {
           LA_decelerate_after = current_block->decelerate_after;
-          final_adv_steps = current_block->final_adv_steps;
-          max_adv_steps = current_block->max_adv_steps;
+          LA_lead_driver = current_block->advance_lead;
+          LOOP_EXTRUDERS(d) {
+            final_adv_steps[d] = current_block->final_adv_steps[d];
+            max_adv_steps[d] = current_block->max_adv_steps[d];
+          }
           //Start the ISR
           nextAdvanceISR = 0;
           eISR_Rate = current_block->advance_speed;
@@ -1571,6 +1587,15 @@ void Stepper::isr() {
     // Stop an active pulse, if any
     #define PULSE_STOP(AXIS) _APPLY_STEP(AXIS)(_INVERT_STEP_PIN(AXIS), 0)
 
+    // Advance the Bresenham counter; a plastic driver leaves its step to the advance ISR
+    #define LA_PULSE_START(AXIS, D) do{ \
+      if (TEST(LA_drivers, D)) { \
+        _COUNTER(AXIS) += current_block->steps[_AXIS(AXIS)]; \
+        if (_COUNTER(AXIS) >= 0) motor_direction(_AXIS(AXIS)) ? --e_steps[D] : ++e_steps[D]; \
+      } \
+      else PULSE_START(AXIS); \
+    }while(0)
+
     #if MINIMUM_STEPPER_PULSE > 0
       hal_timer_t pulse_start = HAL_timer_get_current_count(STEPPER_TIMER);
     #endif
@@ -1587,38 +1612,33 @@ void Stepper::isr() {
 
     #if ENABLED(LIN_ADVANCE)
 
-      counter_E += current_block->steps[E_AXIS];
-      if (counter_E >= 0) {
-        #if DISABLED(COLOR_MIXING_EXTRUDER)
-          // Don't step E here for mixing extruder
-          motor_direction(E_AXIS) ? --e_steps : ++e_steps;
-        #endif
-      }
-
       #if ENABLED(COLOR_MIXING_EXTRUDER)
+        // Keep updating the single E axis
+        counter_E += current_block->steps[E_AXIS];
         // Step mixing steppers proportionally
         MIXING_STEPPERS_LOOP(j) {
           counter_m[j] += current_block->steps[E_AXIS];
           if (counter_m[j] >= 0) {
             counter_m[j] -= current_block->mix_event_count[j];
-            motor_direction(E_AXIS) ? --e_steps : ++e_steps;
+            motor_direction(E_AXIS) ? --e_steps[0] : ++e_steps[0];
           }
         }
 	  #else
+		LA_PULSE_START(E, 0);
 		#if DRIVER_EXTRUDERS > 1
-			PULSE_START(U);
+			LA_PULSE_START(U, 1);
 		#endif
 		#if DRIVER_EXTRUDERS > 2
-			PULSE_START(V);
+			LA_PULSE_START(V, 2);
 		#endif
 		#if DRIVER_EXTRUDERS > 3
-			PULSE_START(W);
+			LA_PULSE_START(W, 3);
 		#endif
 		#if DRIVER_EXTRUDERS > 4
-			PULSE_START(K);
+			LA_PULSE_START(K, 4);
 		#endif
 		#if DRIVER_EXTRUDERS > 5
-			PULSE_START(L);
+			LA_PULSE_START(L, 5);
 		#endif
       #endif
 
@@ -1739,9 +1759,7 @@ void Stepper::isr() {
 			}
 		#endif
 	  #else // !COLOR_MIXING_EXTRUDER
-		#if DISABLED(LIN_ADVANCE)
-			PULSE_STOP(E);
-		#endif
+		PULSE_STOP(E);
 		#if DRIVER_EXTRUDERS > 1
 			PULSE_STOP(U);
 		#endif
@@ -1834,9 +1852,9 @@ void Stepper::isr() {
     #if ENABLED(LIN_ADVANCE)
 
       if (current_block->use_advance_lead) {
-    	if (e_steps && eISR_Rate != current_block->advance_speed) nextAdvanceISR = 0;
+    	if (e_steps_pending() && eISR_Rate != current_block->advance_speed) nextAdvanceISR = 0;
       }
-      else if (e_steps) nextAdvanceISR = 0;
+      else if (e_steps_pending()) nextAdvanceISR = 0;
 
     #endif // ENABLED(LIN_ADVANCE)
   }
@@ -1884,12 +1902,12 @@ void Stepper::isr() {
     #if ENABLED(LIN_ADVANCE)
 
       if (current_block->use_advance_lead) {
-        if (step_events_completed <= (uint32_t)current_block->decelerate_after + step_loops || (e_steps && eISR_Rate != current_block->advance_speed)) {
+        if (step_events_completed <= (uint32_t)current_block->decelerate_after + step_loops || (e_steps_pending() && eISR_Rate != current_block->advance_speed)) {
           nextAdvanceISR = 0; // Wake up eISR on first deceleration loop
           eISR_Rate = current_block->advance_speed;
         }
       }
-      else if (e_steps) nextAdvanceISR = 0;
+      else if (e_steps_pending()) nextAdvanceISR = 0;
 
     #endif // ENABLED(LIN_ADVANCE_DEV)
   }
@@ -1898,7 +1916,7 @@ void Stepper::isr() {
     #if ENABLED(LIN_ADVANCE)
 
       // If we have esteps to execute, fire the next advance_isr "now"
-      if (e_steps && eISR_Rate != current_block->advance_speed) nextAdvanceISR = 0;
+      if (e_steps_pending() && eISR_Rate != current_block->advance_speed) nextAdvanceISR = 0;
 
     #endif
 
@@ -1915,6 +1933,21 @@ void Stepper::isr() {
 
   // If current block is finished, reset pointer
   if (all_steps_done) {
+    #if HAS_SERVOS
+      if (TEST(current_block->flag, BLOCK_BIT_FIBER_CUT)) {
+        servo[tools.cut_servo_id].write(tools.cut_active_angle);
+        fiber_cut_start_ms = millis();
+        fiber_cut_end_ms = fiber_cut_start_ms + tools.cut_dwell;
+        fiber_cut_pending = true;
+      }
+    #endif
+    // Extrusion accounting, once per block
+    LOOP_EXTRUDERS(d) {
+      if (TEST(current_block->direction_bits, XYZ + d))
+        extruded_steps[d] -= current_block->steps[XYZ + d];
+      else
+        extruded_steps[d] += current_block->steps[XYZ + d];
+    }
     current_block = NULL;
     planner.discard_current_block();
 
@@ -1926,37 +1959,51 @@ void Stepper::isr() {
 
 #if ENABLED(LIN_ADVANCE)
 
-  // Timer interrupt for E. e_steps is set in the main routine;
+  // Timer interrupt for the plastic drivers. e_steps is set in the main routine;
   void Stepper::advance_isr() {
 
-    #if ENABLED(DUAL_X_CARRIAGE)
-      #define SET_E_STEP_DIR(INDEX) do{ if (e_steps) { if (e_steps < 0) REV_E_DIR(); else NORM_E_DIR(); } }while(0)
-    #else
-      #define SET_E_STEP_DIR(INDEX) do{ if (e_steps) { if (e_steps < 0) REV_E_DIR(); else NORM_E_DIR(); } }while(0)
-    #endif
-
-    #if ENABLED(DUAL_X_CARRIAGE)
-      #define START_E_PULSE(INDEX)  do{ if (e_steps) E_STEP_WRITE(!INVERT_E_STEP_PIN); }while(0)
-      #define STOP_E_PULSE(INDEX)   do{ if (e_steps) { E_STEP_WRITE(INVERT_E_STEP_PIN); e_steps < 0 ? ++e_steps : --e_steps; } }while(0)
-    #else
-      #define START_E_PULSE(INDEX)  do{ if (e_steps) E_STEP_WRITE(!INVERT_E_STEP_PIN); }while(0)
-      #define STOP_E_PULSE(INDEX)   do{ if (e_steps) { E_STEP_WRITE(INVERT_E_STEP_PIN); e_steps < 0 ? ++e_steps : --e_steps; } }while(0)
-    #endif
-
-
+    #define SET_E_STEP_DIR(AXIS, D) do{ if (e_steps[D]) { if (e_steps[D] < 0) REV_## AXIS ##_DIR(); else NORM_## AXIS ##_DIR(); } }while(0)
+    #define START_E_PULSE(AXIS, D)  do{ if (e_steps[D]) AXIS ##_STEP_WRITE(!INVERT_E_STEP_PIN); }while(0)
+    #define STOP_E_PULSE(AXIS, D)   do{ if (e_steps[D]) { AXIS ##_STEP_WRITE(INVERT_E_STEP_PIN); e_steps[D] < 0 ? ++e_steps[D] : --e_steps[D]; } }while(0)
 
     if (use_advance_lead) {
-      if (step_events_completed > LA_decelerate_after && current_adv_steps > final_adv_steps) {
-        e_steps--;
-        current_adv_steps--;
-        nextAdvanceISR = eISR_Rate;
+      const uint8_t lead = LA_lead_driver;
+      bool stepped = false;
+
+      // The lead driver builds or releases its pressure one step at a time
+      if (step_events_completed > LA_decelerate_after && current_adv_steps[lead] > final_adv_steps[lead]) {
+        e_steps[lead]--;
+        current_adv_steps[lead]--;
+        stepped = true;
       }
-      else if (step_events_completed < LA_decelerate_after && current_adv_steps < max_adv_steps) {
+      else if (step_events_completed < LA_decelerate_after && current_adv_steps[lead] < max_adv_steps[lead]) {
              //step_events_completed <= (uint32_t)current_block->accelerate_until) {
-        e_steps++;
-        current_adv_steps++;
-        nextAdvanceISR = eISR_Rate;
+        e_steps[lead]++;
+        current_adv_steps[lead]++;
+        stepped = true;
       }
+
+      // The other drivers follow the pressure of the lead in proportion, one step at most
+      if (max_adv_steps[lead]) {
+        LOOP_EXTRUDERS(d) {
+          if (d == lead || !TEST(use_advance_lead, d)) continue;
+          uint16_t target = (uint32_t)current_adv_steps[lead] * max_adv_steps[d] / max_adv_steps[lead];
+          NOMORE(target, max_adv_steps[d]);
+          if (current_adv_steps[d] < target) {
+            e_steps[d]++;
+            current_adv_steps[d]++;
+            stepped = true;
+          }
+          else if (current_adv_steps[d] > target) {
+            e_steps[d]--;
+            current_adv_steps[d]--;
+            stepped = true;
+          }
+        }
+      }
+
+      if (stepped)
+        nextAdvanceISR = eISR_Rate;
       else {
         nextAdvanceISR = ADV_NEVER;
         eISR_Rate = ADV_NEVER;
@@ -1965,53 +2012,50 @@ void Stepper::isr() {
     else
       nextAdvanceISR = ADV_NEVER;
 
-    SET_E_STEP_DIR(0);
-    /*switch(LA_active_extruder) {
-      case 0: SET_E_STEP_DIR(0); break;
+    SET_E_STEP_DIR(E, 0);
+    #if DISABLED(COLOR_MIXING_EXTRUDER)
       #if DRIVER_EXTRUDERS > 1
-        case 1: SET_E_STEP_DIR(1); break;
-        #if DRIVER_EXTRUDERS > 2
-          case 2: SET_E_STEP_DIR(2); break;
-          #if DRIVER_EXTRUDERS > 3
-            case 3: SET_E_STEP_DIR(3); break;
-            #if DRIVER_EXTRUDERS > 4
-              case 4: SET_E_STEP_DIR(4); break;
-              #if DRIVER_EXTRUDERS > 5
-                case 5: SET_E_STEP_DIR(5); break;
-              #endif // EXTRUDERS > 5
-            #endif // EXTRUDERS > 4
-          #endif // EXTRUDERS > 3
-        #endif // EXTRUDERS > 2
-      #endif // EXTRUDERS > 1
-    }*/
-
-    // Step E stepper if we have steps
-    while (e_steps) {
+        SET_E_STEP_DIR(U, 1);
+      #endif
+      #if DRIVER_EXTRUDERS > 2
+        SET_E_STEP_DIR(V, 2);
+      #endif
+      #if DRIVER_EXTRUDERS > 3
+        SET_E_STEP_DIR(W, 3);
+      #endif
+      #if DRIVER_EXTRUDERS > 4
+        SET_E_STEP_DIR(K, 4);
+      #endif
+      #if DRIVER_EXTRUDERS > 5
+        SET_E_STEP_DIR(L, 5);
+      #endif
+    #endif
+
+    // Step the drivers that have steps, all of them on the same pulse
+    while (e_steps_pending()) {
 
       #if MINIMUM_STEPPER_PULSE > 0
         hal_timer_t pulse_start = HAL_timer_get_current_count(STEPPER_TIMER);
       #endif
 
-
-      START_E_PULSE(0);
-      /*switch(LA_active_extruder) {
-        case 0: START_E_PULSE(0); break;
+      START_E_PULSE(E, 0);
+      #if DISABLED(COLOR_MIXING_EXTRUDER)
         #if DRIVER_EXTRUDERS > 1
-          case 1: START_E_PULSE(1); break;
-          #if DRIVER_EXTRUDERS > 2
-            case 2: START_E_PULSE(2); break;
-            #if DRIVER_EXTRUDERS > 3
-              case 3: START_E_PULSE(3); break;
-              #if DRIVER_EXTRUDERS > 4
-                case 4: START_E_PULSE(4); break;
-                #if DRIVER_EXTRUDERS > 5
-                  case 5: START_E_PULSE(5); break;
-                #endif // EXTRUDERS > 5
-              #endif // EXTRUDERS > 4
-            #endif // EXTRUDERS > 3
-          #endif // EXTRUDERS > 2
-        #endif // EXTRUDERS > 1
-      }*/
+          START_E_PULSE(U, 1);
+        #endif
+        #if DRIVER_EXTRUDERS > 2
+          START_E_PULSE(V, 2);
+        #endif
+        #if DRIVER_EXTRUDERS > 3
+          START_E_PULSE(W, 3);
+        #endif
+        #if DRIVER_EXTRUDERS > 4
+          START_E_PULSE(K, 4);
+        #endif
+        #if DRIVER_EXTRUDERS > 5
+          START_E_PULSE(L, 5);
+        #endif
+      #endif
 
       // For a minimum pulse time wait before stopping pulses
       #if MINIMUM_STEPPER_PULSE > 0
@@ -2019,25 +2063,24 @@ void Stepper::isr() {
         pulse_start = HAL_timer_get_current_count(STEPPER_TIMER);
       #endif
 
-      STOP_E_PULSE(0);
-      /*switch(LA_active_extruder) {
-        case 0: STOP_E_PULSE(0); break;
+      STOP_E_PULSE(E, 0);
+      #if DISABLED(COLOR_MIXING_EXTRUDER)
         #if DRIVER_EXTRUDERS > 1
-          case 1: STOP_E_PULSE(1); break;
-          #if DRIVER_EXTRUDERS > 2
-            case 2: STOP_E_PULSE(2); break;
-            #if DRIVER_EXTRUDERS > 3
-              case 3: STOP_E_PULSE(3); break;
-              #if DRIVER_EXTRUDERS > 4
-                case 4: STOP_E_PULSE(4); break;
-                #if DRIVER_EXTRUDERS > 5
-                  case 5: STOP_E_PULSE(5); break;
-                #endif // EXTRUDERS > 5
-              #endif // EXTRUDERS > 4
-            #endif // EXTRUDERS > 3
-          #endif // EXTRUDERS > 2
-        #endif // EXTRUDERS > 1
-      }*/
+          STOP_E_PULSE(U, 1);
+        #endif
+        #if DRIVER_EXTRUDERS > 2
+          STOP_E_PULSE(V, 2);
+        #endif
+        #if DRIVER_EXTRUDERS > 3
+          STOP_E_PULSE(W, 3);
+        #endif
+        #if DRIVER_EXTRUDERS > 4
+          STOP_E_PULSE(K, 4);
+        #endif
+        #if DRIVER_EXTRUDERS > 5
+          STOP_E_PULSE(L, 5);
+        #endif
+      #endif
 
     // For minimum pulse time wait before looping
     #if MINIMUM_STEPPER_PULSE > 0
@@ -2348,6 +2391,12 @@ void Stepper::init() {
 
   #endif // HAS_EXT_ENCODER
 
+  #if ENABLED(LIN_ADVANCE)
+    // The plastic drivers step from the advance ISR, the fiber drivers from the main ISR
+    LA_drivers = 0;
+    LOOP_EXTRUDERS(d) if (tools.extruder_driver_is_plastic(AxisEnum(E_AXIS + d))) SBI(LA_drivers, d);
+  #endif
+
   // Init Stepper ISR to 122 Hz for quick starting
   HAL_STEPPER_TIMER_START();
   ENABLE_STEPPER_INTERRUPT();
@@ -2362,7 +2411,11 @@ void Stepper::init() {
  * Block until all buffered steps are executed / cleaned
  */
 void Stepper::synchronize() {
-  while (planner.has_blocks_queued() || cleaning_buffer_counter) {
+  while (planner.has_blocks_queued() || cleaning_buffer_counter
+    #if HAS_SERVOS
+      || fiber_cut_pending
+    #endif
+  ) {
     printer.idle();
     printer.keepalive(InProcess);
   }
@@ -2433,6 +2486,14 @@ long Stepper::position(const AxisEnum axis) {
   return machine_pos;
 }
 
+int32_t Stepper::take_extruded_steps(const uint8_t d) {
+  CRITICAL_SECTION_START
+    const int32_t steps = extruded_steps[d];
+    extruded_steps[d] = 0;
+  CRITICAL_SECTION_END
+  return steps;
+}
+
 /**
  * Get an axis position according to stepper position(s)
  * For CORE machines apply translation from ABC to XYZ.
@@ -2509,6 +2570,10 @@ void Stepper::quick_stop() {
   current_block = NULL;
   cleaning_buffer_counter = 5000;
   planner.clear_block_buffer();
+  #if HAS_SERVOS
+    // The cuts of the discarded blocks never reach the ISR, only a closed blade still opens
+    tools.cuts_queued = fiber_cut_pending ? 1 : 0;
+  #endif
   ENABLE_STEPPER_INTERRUPT();
   #if ENABLED(ULTRA_LCD)
     planner.clear_block_buffer_runtime();
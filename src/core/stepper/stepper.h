@@ -69,8 +69,19 @@ class Stepper {
 
     static int16_t cleaning_buffer_counter;
 
+    #if HAS_SERVOS
+      static volatile bool fiber_cut_pending;   // Blade closed, waiting for the dwell
+    #endif
+
+    static volatile int32_t extruded_steps[DRIVER_EXTRUDERS];  // Net steps of the blocks done, not yet taken
+
   private: /** Private Parameters */
 
+    #if HAS_SERVOS
+      static millis_l fiber_cut_start_ms,
+                      fiber_cut_end_ms;
+    #endif
+
     static uint16_t last_direction_bits;        // The next stepping-bits to be output
 
     #if ENABLED(X_TWO_ENDSTOPS)
@@ -122,16 +133,17 @@ class Stepper {
                           nextAdvanceISR,
                           eISR_Rate;
 
-      static uint16_t     current_adv_steps,
-                          final_adv_steps,
-                          max_adv_steps;        // Copy from current executed block. Needed because current_block is set to NULL "too early".
+      static uint16_t     current_adv_steps[DRIVER_EXTRUDERS],
+                          final_adv_steps[DRIVER_EXTRUDERS],
+                          max_adv_steps[DRIVER_EXTRUDERS];  // Copy from current executed block. Needed because current_block is set to NULL "too early".
 
       #define _NEXT_ISR(T) nextMainISR = T
 
-      static int8_t       e_steps,
-                          LA_active_extruder;   // Copy from current executed block. Needed because current_block is set to NULL "too early".
+      static int8_t       e_steps[DRIVER_EXTRUDERS];
 
-      static bool         use_advance_lead;
+      static uint8_t      LA_drivers,           // Plastic drivers, stepped by the advance ISR
+                          LA_lead_driver,       // Copy from current executed block. Needed because current_block is set to NULL "too early".
+                          use_advance_lead;     // Drivers with advance in the current block
 
     #else // !LIN_ADVANCE
 
@@ -195,6 +207,10 @@ class Stepper {
     #if ENABLED(LIN_ADVANCE)
       static void advance_isr();
       static void advance_isr_scheduler();
+      FORCE_INLINE static bool e_steps_pending() {
+        LOOP_EXTRUDERS(d) if (e_steps[d]) return true;
+        return false;
+      }
     #endif
 
     //
@@ -224,6 +240,11 @@ class Stepper {
     //
     static void report_positions();
 
+    //
+    // Get and clear the net steps of the blocks done on an extruder driver
+    //
+    static int32_t take_extruded_steps(const uint8_t d);
+
     //
     // Get the position (mm) of an axis based on stepper position(s)
     //
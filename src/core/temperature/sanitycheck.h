@@ -151,6 +151,17 @@
 #if DISABLED(DEFAULT_Kd)
   #error "DEPENDENCY ERROR: Missing setting DEFAULT_Kd."
 #endif
+#if ENABLED(PID_FEEDFORWARD)
+  #if !PIDTEMP
+    #error "DEPENDENCY ERROR: PID_FEEDFORWARD needs PIDTEMP."
+  #elif ENABLED(PID_ADD_EXTRUSION_RATE)
+    #error "DEPENDENCY ERROR: PID_FEEDFORWARD is incompatible with PID_ADD_EXTRUSION_RATE."
+  #elif DISABLED(PID_FEEDFORWARD_TIME)
+    #error "DEPENDENCY ERROR: Missing setting PID_FEEDFORWARD_TIME."
+  #elif DISABLED(DEFAULT_Kf)
+    #error "DEPENDENCY ERROR: Missing setting DEFAULT_Kf."
+  #endif
+#endif
 #if (PIDTEMPBED)
   #if !HAS_TEMP_BED
     #error "DEPENDENCY ERROR: Missing setting TEMP_SENSOR_BED for use PIDTEMPBED."
@@ -259,5 +270,48 @@
     #error "DEPENDENCY ERROR: Missing setting WATCH_TEMP_INCREASE."
   #endif
 #endif
+#if ENABLED(HEATER_POWER_BUDGET)
+  #if HEATER_POWER_BUDGET <= 0
+    #error "DEPENDENCY ERROR: HEATER_POWER_BUDGET must be greater than 0."
+  #endif
+  #if DISABLED(HOTEND_POWER)
+    #error "DEPENDENCY ERROR: Missing setting HOTEND_POWER."
+  #endif
+  #if DISABLED(BED_POWER)
+    #error "DEPENDENCY ERROR: Missing setting BED_POWER."
+  #endif
+  #if DISABLED(CHAMBER_POWER)
+    #error "DEPENDENCY ERROR: Missing setting CHAMBER_POWER."
+  #endif
+  #if DISABLED(COOLER_POWER)
+    #error "DEPENDENCY ERROR: Missing setting COOLER_POWER."
+  #endif
+#endif
+#if ENABLED(THERMAL_LOG)
+  #if DISABLED(THERMAL_LOG_SIZE)
+    #error "DEPENDENCY ERROR: Missing setting THERMAL_LOG_SIZE."
+  #elif THERMAL_LOG_SIZE < 2 || THERMAL_LOG_SIZE > 65535
+    #error "DEPENDENCY ERROR: THERMAL_LOG_SIZE must be between 2 and 65535."
+  #endif
+  #if DISABLED(THERMAL_LOG_INTERVAL)
+    #error "DEPENDENCY ERROR: Missing setting THERMAL_LOG_INTERVAL."
+  #elif THERMAL_LOG_INTERVAL < 1 || THERMAL_LOG_INTERVAL > 255
+    #error "DEPENDENCY ERROR: THERMAL_LOG_INTERVAL must be between 1 and 255."
+  #endif
+#endif
+
+#if ENABLED(HOTEND_STANDBY)
+  #if DISABLED(HOTEND_STANDBY_TEMP)
+    #error "DEPENDENCY ERROR: Missing setting HOTEND_STANDBY_TEMP."
+  #elif DISABLED(HOTEND_STANDBY_DELAY)
+    #error "DEPENDENCY ERROR: Missing setting HOTEND_STANDBY_DELAY."
+  #elif DISABLED(HOTEND_STANDBY_LEAD)
+    #error "DEPENDENCY ERROR: Missing setting HOTEND_STANDBY_LEAD."
+  #elif DISABLED(HOTEND_STANDBY_HEATUP_RATE)
+    #error "DEPENDENCY ERROR: Missing setting HOTEND_STANDBY_HEATUP_RATE."
+  #elif HOTEND_STANDBY_TEMP <= 0
+    #error "DEPENDENCY ERROR: HOTEND_STANDBY_TEMP must be greater than 0."
+  #endif
+#endif
 
 #endif /* _TEMPERATURE_SANITYCHECK_H_ */
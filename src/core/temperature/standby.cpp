@@ -0,0 +1,197 @@
+/**
+ * MK4duo Firmware for 3D Printer, Laser and CNC
+ *
+ * Based on Marlin, Sprinter and grbl
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ * Copyright (C) 2013 Alberto Cotronei @MagoKimbra
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include "../../../MK4duo.h"
+
+#if HAS_HOTEND_STANDBY
+
+  HotendStandby standby;
+
+  float         HotendStandby::heatup_rate[HOTENDS];
+
+  bool          HotendStandby::printing               = false;
+  int8_t        HotendStandby::fiber_hotend           = -1;
+  StandbyState  HotendStandby::state[HOTENDS]         = { STANDBY_OFF };
+  int16_t       HotendStandby::work_temp[HOTENDS]     = { 0 };
+  float         HotendStandby::start_temp[HOTENDS]    = { 0.0 };
+  millis_l      HotendStandby::left_ms[HOTENDS]       = { 0 },
+                HotendStandby::gap_ms[HOTENDS]        = { 0 },
+                HotendStandby::heat_ms[HOTENDS]       = { 0 };
+
+  /**
+   * Public Function
+   */
+  void HotendStandby::init() {
+    LOOP_HOTEND() heatup_rate[h] = HOTEND_STANDBY_HEATUP_RATE;
+
+    // M1001 starts a section printed by the hotend of the fiber driver
+    const uint8_t driver_hotend[] = DRIVER_EXTRUDERS_HOTENDS,
+                  plastic_driver[] = PLASTIC_DRIVER_EXTRUDERS;
+    LOOP_EXTRUDERS(d) {
+      if (!plastic_driver[d] && driver_hotend[d] < HOTENDS) {
+        fiber_hotend = driver_hotend[d];
+        break;
+      }
+    }
+  }
+
+  // Called by the scheduler
+  void HotendStandby::spin() {
+
+    const millis_l now = millis();
+
+    if (!print_job_counter.isRunning()) {
+      if (printing) {
+        printing = false;
+        // Pause or end of the print, give back the targets not changed since
+        LOOP_HOTEND() {
+          if (state[h] == STANDBY_LOW && heaters[h].target_temp_nocorr == HOTEND_STANDBY_TEMP)
+            heaters[h].setTarget(work_temp[h]);
+          state[h] = STANDBY_OFF;
+        }
+      }
+      return;
+    }
+
+    if (!printing) {
+      printing = true;
+      LOOP_HOTEND() {
+        left_ms[h] = h == EXTRUDER_IDX ? 0 : now;
+        gap_ms[h] = 0;
+      }
+    }
+
+    const uint8_t queued = queued_hotends();
+
+    LOOP_HOTEND() {
+
+      Heater *act = &heaters[h];
+
+      switch (state[h]) {
+
+        case STANDBY_OFF:
+          if (h == EXTRUDER_IDX || !left_ms[h] || TEST(queued, h)) break;
+          if (act->isTuning() || act->isIdle() || act->target_temp_nocorr <= HOTEND_STANDBY_TEMP) break;
+          if (gap_ms[h]) {
+            // Only with the time to cool down and heat up again
+            const millis_l next_use = left_ms[h] + gap_ms[h];
+            if (ELAPSED(now + 2 * heatup_time(h, HOTEND_STANDBY_TEMP, act->target_temp_nocorr), next_use)) break;
+          }
+          else if (PENDING(now, left_ms[h] + (HOTEND_STANDBY_DELAY) * 1000UL)) break;
+          go_low(h);
+          break;
+
+        case STANDBY_LOW:
+          if (act->target_temp_nocorr != HOTEND_STANDBY_TEMP) {
+            state[h] = STANDBY_OFF;
+            break;
+          }
+          if (TEST(queued, h) || (gap_ms[h] && ELAPSED(now + heatup_time(h, act->current_temperature, work_temp[h]), left_ms[h] + gap_ms[h])))
+            heat_up(h);
+          break;
+
+        case STANDBY_HEATING:
+          if (act->target_temp_nocorr != work_temp[h]) {
+            state[h] = STANDBY_OFF;
+            break;
+          }
+          if (act->current_temperature >= act->target_temperature - (TEMP_WINDOW)) {
+            const float rise = act->current_temperature - start_temp[h];
+            const millis_l time = now - heat_ms[h];
+            // A short rise says little of the rate
+            if (rise >= 10 && time) heatup_rate[h] = (heatup_rate[h] + rise * 1000.0f / time) * 0.5f;
+            state[h] = STANDBY_OFF;
+          }
+          break;
+      }
+    }
+  }
+
+  void HotendStandby::tool_change(const uint8_t from, const uint8_t to) {
+
+    if (!printing || from == to) return;
+
+    const millis_l now = millis();
+
+    if (from < HOTENDS) left_ms[from] = now;
+
+    if (to < HOTENDS) {
+      if (left_ms[to]) {
+        const millis_l gap = now - left_ms[to];
+        gap_ms[to] = gap_ms[to] ? (gap_ms[to] + gap) >> 1 : gap;
+        left_ms[to] = 0;
+      }
+      if (state[to] == STANDBY_LOW && heaters[to].target_temp_nocorr == HOTEND_STANDBY_TEMP) heat_up(to);
+      if (state[to] == STANDBY_HEATING) thermalManager.wait_heater(&heaters[to]);
+    }
+  }
+
+  /**
+   * Private Function
+   */
+
+  // Hotends used by the T and M1001 commands in the command ring
+  uint8_t HotendStandby::queued_hotends() {
+
+    uint8_t hotends = 0;
+
+    for (uint8_t i = 0; i < commands.buffer_ring.count(); i++) {
+
+      const char *p = commands.queued_line(i);
+      int16_t code;
+      const char letter = commands.peek_command(p, code);
+
+      if (letter == 'T') {
+        if (WITHIN(code, 0, HOTENDS - 1)) SBI(hotends, code);
+      }
+      else if (letter == 'M' && code == 1001 && fiber_hotend >= 0)
+        SBI(hotends, fiber_hotend);
+    }
+
+    return hotends;
+  }
+
+  // Time to heat up from a temperature to another, plus the lead
+  millis_l HotendStandby::heatup_time(const uint8_t h, const float from, const float to) {
+    const float rise = to > from ? to - from : 0.0f;
+    return (millis_l)(rise * 1000.0f / heatup_rate[h]) + (HOTEND_STANDBY_LEAD) * 1000UL;
+  }
+
+  void HotendStandby::go_low(const uint8_t h) {
+    work_temp[h] = heaters[h].target_temp_nocorr;
+    heaters[h].setTarget(HOTEND_STANDBY_TEMP);
+    state[h] = STANDBY_LOW;
+    SERIAL_SMV(ECHO, "Hotend ", (int)h);
+    SERIAL_EMV(" standby ", HOTEND_STANDBY_TEMP);
+  }
+
+  void HotendStandby::heat_up(const uint8_t h) {
+    start_temp[h] = heaters[h].current_temperature;
+    heat_ms[h] = millis();
+    heaters[h].setTarget(work_temp[h]);
+    state[h] = STANDBY_HEATING;
+    SERIAL_SMV(ECHO, "Hotend ", (int)h);
+    SERIAL_EMV(" back to ", work_temp[h]);
+  }
+
+#endif // HAS_HOTEND_STANDBY
@@ -0,0 +1,82 @@
+/**
+ * MK4duo Firmware for 3D Printer, Laser and CNC
+ *
+ * Based on Marlin, Sprinter and grbl
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ * Copyright (C) 2013 Alberto Cotronei @MagoKimbra
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * standby.h - Hotend standby driven by the forecast of the next tool use
+ *
+ * While printing, a hotend left by a tool change drops to HOTEND_STANDBY_TEMP
+ * when the time to its next use leaves room to cool and heat up again. The next
+ * use comes from the time the hotend stayed unused the last times and from the
+ * T and M1001 commands waiting in the command ring. Heating starts back when the
+ * remaining time is the heat up time, at the rate measured on the last heat up,
+ * plus HOTEND_STANDBY_LEAD. A tool change to a hotend still in standby waits for it.
+ * A new target set by any command takes the hotend out of standby.
+ */
+
+#ifndef _STANDBY_H_
+#define _STANDBY_H_
+
+#if HAS_HOTEND_STANDBY
+
+  enum StandbyState : uint8_t { STANDBY_OFF, STANDBY_LOW, STANDBY_HEATING };
+
+  class HotendStandby {
+
+    public: /** Constructor */
+
+      HotendStandby() {}
+
+    public: /** Public Parameters */
+
+      static float        heatup_rate[HOTENDS];   // C/s
+
+    private: /** Private Parameters */
+
+      static bool         printing;
+      static int8_t       fiber_hotend;
+      static StandbyState state[HOTENDS];
+      static int16_t      work_temp[HOTENDS];     // Target to go back to
+      static float        start_temp[HOTENDS];
+      static millis_l     left_ms[HOTENDS],       // Last time the hotend was left, 0 while in use
+                          gap_ms[HOTENDS],        // Time the hotend stays unused, 0 not known
+                          heat_ms[HOTENDS];
+
+    public: /** Public Function */
+
+      static void init();
+      static void spin();
+      static void tool_change(const uint8_t from, const uint8_t to);
+
+    private: /** Private Function */
+
+      static uint8_t queued_hotends();
+      static millis_l heatup_time(const uint8_t h, const float from, const float to);
+      static void go_low(const uint8_t h);
+      static void heat_up(const uint8_t h);
+
+  };
+
+  extern HotendStandby standby;
+
+#endif // HAS_HOTEND_STANDBY
+
+#endif /* _STANDBY_H_ */
@@ -30,6 +30,11 @@ Temperature thermalManager;
 
 constexpr bool      thermal_protection[HEATER_TYPE]   = { THERMAL_PROTECTION_HOTENDS, THERMAL_PROTECTION_BED, THERMAL_PROTECTION_CHAMBER, THERMAL_PROTECTION_COOLER };
 
+#if ENABLED(HEATER_POWER_BUDGET)
+  constexpr uint16_t  hotend_power[]                  = HOTEND_POWER,
+                      heater_power[HEATER_TYPE]       = { 0, BED_POWER, CHAMBER_POWER, COOLER_POWER };
+#endif
+
 // public:
 bool Temperature::tempError = false;
 
@@ -51,7 +56,8 @@ bool Temperature::tempError = false;
 
 // private:
 
-uint8_t Temperature::pid_pointer = 255;
+Temperature::autotune_t Temperature::autotune[HEATER_COUNT];
+bool Temperature::autotune_old_report = false;
 
 #if ENABLED(FILAMENT_SENSOR)
   int8_t    Temperature::meas_shift_index;          // Index of a delayed sample in buffer
@@ -84,7 +90,8 @@ void Temperature::wait_heater(Heater *act, bool no_wait_for_cooling/*=true*/) {
   #if TEMP_RESIDENCY_TIME > 0
     millis_l residency_start_ms = 0;
     // Loop until the temperature has stabilized
-    #define TEMP_CONDITIONS (!residency_start_ms || PENDING(now, residency_start_ms + (TEMP_RESIDENCY_TIME) * 1000UL))
+    bool residency_reached = false;
+    #define TEMP_CONDITIONS (!residency_reached)
   #else
     #define TEMP_CONDITIONS (wants_to_cool ? act->isCooling() : act->isHeating())
   #endif
@@ -99,6 +106,10 @@ void Temperature::wait_heater(Heater *act, bool no_wait_for_cooling/*=true*/) {
   const bool oldReport = printer.isAutoreportTemp();
   printer.setAutoreportTemp(true);
 
+  #if ENABLED(PARALLEL_HEATUP)
+    start_queued_heaters();
+  #endif
+
   #if ENABLED(PRINTER_EVENT_LEDS)
     const float start_temp = act->current_temperature;
     uint8_t old_blue = 0;
@@ -151,16 +162,7 @@ void Temperature::wait_heater(Heater *act, bool no_wait_for_cooling/*=true*/) {
 
     #if TEMP_RESIDENCY_TIME > 0
 
-      const float temp_diff = FABS(act->target_temperature - temp);
-
-      if (!residency_start_ms) {
-        // Start the TEMP_RESIDENCY_TIME timer when we reach target temp for the first time.
-        if (temp_diff < TEMP_WINDOW) residency_start_ms = now;
-      }
-      else if (temp_diff > TEMP_HYSTERESIS) {
-        // Restart the timer whenever the temperature falls outside the hysteresis.
-        residency_start_ms = now;
-      }
+      residency_reached = check_residency(residency_start_ms, FABS(act->target_temperature - temp), now);
 
     #endif
 
@@ -189,6 +191,85 @@ void Temperature::wait_heater(Heater *act, bool no_wait_for_cooling/*=true*/) {
   printer.setAutoreportTemp(oldReport);
 }
 
+/**
+ * Wait until every heater with a target has reached it.
+ * Heaters above their target and coolers do not hold the wait.
+ */
+void Temperature::wait_all_heaters() {
+
+  #if TEMP_RESIDENCY_TIME > 0
+    millis_l residency_start_ms[HEATER_COUNT] = { 0 };
+  #endif
+
+  bool reached;
+
+  printer.setWaitForHeatUp(true);
+
+  const bool oldReport = printer.isAutoreportTemp();
+  printer.setAutoreportTemp(true);
+
+  #if ENABLED(PARALLEL_HEATUP)
+    start_queued_heaters();
+  #endif
+
+  do {
+
+    printer.idle();
+    printer.keepalive(WaitHeater);
+    stepper.move_watch.start(); // Keep steppers powered
+
+    #if TEMP_RESIDENCY_TIME > 0
+      const millis_l now = millis();
+    #endif
+
+    reached = true;
+
+    LOOP_HEATER() {
+
+      Heater *act = &heaters[h];
+      if (act->type == IS_COOLER || act->isOFF() || act->isIdle()) continue;
+
+      const float temp_diff = act->target_temperature - act->current_temperature;
+
+      #if TEMP_RESIDENCY_TIME > 0
+        if (!check_residency(residency_start_ms[h], temp_diff, now)) reached = false;
+      #else
+        if (temp_diff > 0) reached = false;
+      #endif
+    }
+
+  } while (printer.isWaitForHeatUp() && !reached);
+
+  if (printer.isWaitForHeatUp()) {
+    #if DISABLED(NEXTION_HMI)
+      lcd_setstatusPGM(PSTR(MSG_HEATING_COMPLETE));
+    #endif
+    #if ENABLED(PRINTER_EVENT_LEDS)
+      leds.set_white();
+    #endif
+  }
+
+  printer.setAutoreportTemp(oldReport);
+}
+
+#if TEMP_RESIDENCY_TIME > 0
+
+  /**
+   * Residency timer of one heater, true when it stayed TEMP_RESIDENCY_TIME at the target.
+   * Start it when the temperature reaches TEMP_WINDOW for the first time,
+   * restart it whenever the temperature falls outside TEMP_HYSTERESIS.
+   */
+  bool Temperature::check_residency(millis_l &residency_start_ms, const float temp_diff, const millis_l now) {
+    if (!residency_start_ms) {
+      if (temp_diff < TEMP_WINDOW) residency_start_ms = now;
+    }
+    else if (temp_diff > TEMP_HYSTERESIS)
+      residency_start_ms = now;
+    return residency_start_ms && ELAPSED(now, residency_start_ms + (TEMP_RESIDENCY_TIME) * 1000UL);
+  }
+
+#endif
+
 void Temperature::set_current_temp_raw() {
 
   #if ANALOG_INPUTS > 0
@@ -205,6 +286,24 @@ void Temperature::set_current_temp_raw() {
 
 }
 
+#if HEATER_USES_MAX
+
+  /**
+   * Sample the SPI thermocouple and RTD sensors in the background.
+   * The heaters are visited in turn and at most one SPI transaction is
+   * done for each call, so the loop never waits on a conversion.
+   */
+  void Temperature::spin_spi_sensors() {
+    static uint8_t next_heater = 0;
+    for (uint8_t i = 0; i < HEATER_COUNT; i++) {
+      const uint8_t h = next_heater;
+      if (++next_heater >= HEATER_COUNT) next_heater = 0;
+      if (heaters[h].sensor.spin_spi()) return;
+    }
+  }
+
+#endif
+
 /**
  * Spin Manage heating activities for heaters, bed, chamber and cooler
  *  - Is called every 100ms.
@@ -216,12 +315,21 @@ void Temperature::set_current_temp_raw() {
  */
 void Temperature::spin() {
 
-  static uint8_t cycle_1_second = 0;
-
-  if (++cycle_1_second == 10) cycle_1_second = 0;
+  static millis_l next_1s_ms = 0;
 
   millis_l ms = millis();
 
+  // On the clock, not on the calls: the scheduler skips the late periods
+  const bool cycle_1_second = ELAPSED(ms, next_1s_ms);
+  if (cycle_1_second) {
+    next_1s_ms += 1000UL;
+    if (ELAPSED(ms, next_1s_ms)) next_1s_ms = ms + 1000UL;
+  }
+
+  #if ENABLED(PID_FEEDFORWARD)
+    planner.update_hotend_flow();
+  #endif
+
   LOOP_HEATER() {
 
     Heater *act = &heaters[h];
@@ -236,11 +344,13 @@ void Temperature::spin() {
     		min_temp_error(act->ID);
     	}
 	#else
-    if (act->isON() && act->current_temperature > act->maxtemp+MAXTEMP_ERROR_THRESHOLD)
+    // The autotune drives the heater with no target, it stays guarded
+    const bool guarded = act->isON() || autotune[h].active;
+    if (guarded && act->current_temperature > act->maxtemp+MAXTEMP_ERROR_THRESHOLD)
     {
     	max_temp_error(act->ID);
     }
-    if (act->isON() && act->current_temperature < act->mintemp)
+    if (guarded && act->current_temperature < act->mintemp)
     {
     	min_temp_error(act->ID);
     }
@@ -254,10 +364,13 @@ void Temperature::spin() {
         thermal_runaway_protection(&thermal_runaway_state_machine[h], &thermal_runaway_timer[h], act->current_temperature, act->target_temperature, h, THERMAL_PROTECTION_PERIOD, THERMAL_PROTECTION_HYSTERESIS);
     #endif
 
-    // Ignore heater we are currently testing
-    if (pid_pointer == act->ID) continue;
+    // Heater driven by the autotune
+    if (autotune[h].active) {
+      autotune_step(act);
+      continue;
+    }
 
-    act->get_pid_output(cycle_1_second == 0);
+    act->get_pid_output(cycle_1_second);
 
     #if WATCH_THE_HEATER
       // Make sure temperature is increasing
@@ -271,6 +384,14 @@ void Temperature::spin() {
 
   } // LOOP_HEATER
 
+  #if ENABLED(HEATER_POWER_BUDGET)
+    limit_heater_power();
+  #endif
+
+  #if HAS_THERMAL_LOG
+    thermallog.spin();
+  #endif
+
   #if HAS_MCU_TEMPERATURE
     mcu_current_temperature = analog2tempMCU(mcu_current_temperature_raw);
     NOLESS(mcu_highest_temperature, mcu_current_temperature);
@@ -330,245 +451,259 @@ void Temperature::spin() {
 /**
  * PID Autotuning (M303)
  *
- * Alternately heat and cool the nozzle, observing its behavior to
+ * Alternately heat and cool the heater, observing its behavior to
  * determine the best PID values to achieve a stable temperature.
+ * Runs in the background from spin(), on as many heaters at once as wanted.
  */
 void Temperature::PID_autotune(Heater *act, const float temp, const uint8_t ncycles, const uint8_t method, const bool storeValues/*=false*/) {
 
-  float currentTemp = 0.0;
-  int cycles = 0;
-  bool heating = true;
+  autotune_t &at = autotune[act->ID];
 
-  const bool oldReport = printer.isAutoreportTemp();
+  if (!isAutotuning()) autotune_old_report = printer.isAutoreportTemp();
   printer.setAutoreportTemp(true);
 
-  disable_all_heaters(); // switch off all heaters.
-
-  millis_l  t1 = millis(),
-            t2 = t1;
-  int32_t   t_high = 0,
-            t_low = 0;
-  float     Ku,
-            Tu,
-            workKp = 0,
-            workKi = 0,
-            workKd = 0,
-            maxTemp = 20.0,
-            minTemp = 20.0;
+  act->setTarget(0);
 
-  const uint8_t pidMax = act->pidMax;
-  act->soft_pwm = pidMax;
+  at.active   = true;
+  at.heating  = true;
+  at.store    = storeValues;
+  at.method   = method;
+  at.cycles   = 0;
+  at.ncycles  = ncycles;
+  at.temp     = temp;
+  at.t1       = at.t2 = millis();
+  at.t_high   = at.t_low = 0;
+  at.bias     = at.d = act->pidMax >> 1;
+  at.maxTemp  = at.minTemp = 20.0;
+  at.Kp       = at.Ki = at.Kd = 0.0;
 
-  int32_t bias  = pidMax >> 1;
-  int32_t d     = pidMax >> 1;
-
-  printer.setWaitForHeatUp(true);
-  pid_pointer = act->ID;
+  act->soft_pwm = act->pidMax;
 
   lcd_reset_alert_level();
   LCD_MESSAGEPGM(MSG_PID_AUTOTUNE_START);
+}
 
-  // PID Tuning loop
-  for(;;) {
+/**
+ * Stop the autotune of a heater, with the reason if it failed
+ */
+void Temperature::autotune_stop(Heater *act, PGM_P const error/*=NULL*/) {
+
+  autotune[act->ID].active = false;
+  act->soft_pwm = 0;
+  act->setTarget(0);
+
+  if (error) {
+    SERIAL_SMV(ER, MSG_PID_AUTOTUNE " H", autotune_heater_code(act));
+    SERIAL_CHR(' ');
+    SERIAL_PS(error);
+    SERIAL_EOL();
+    lcd_setalertstatusPGM(error);
+    #if ENABLED(NEXTION_HMI)
+      NextionHMI::RaiseEvent(HMIevent::ERROR, 0, error);
+    #endif
+  }
 
-    watchdog.reset(); // Reset the watchdog
-    printer.idle();
-    printer.keepalive(WaitHeater);
+  if (!isAutotuning()) {
+    printer.setAutoreportTemp(autotune_old_report);
+    if (!error) LCD_MESSAGEPGM(WELCOME_MSG);
+  }
+}
 
-    act->updateCurrentTemperature();
+/**
+ * One relay step of the autotune, called by spin() every 100ms
+ */
+void Temperature::autotune_step(Heater *act) {
 
-    const millis_l time = millis();
-    currentTemp = act->current_temperature;
-    NOLESS(maxTemp, currentTemp);
-    NOMORE(minTemp, currentTemp);
+  autotune_t &at = autotune[act->ID];
 
-    if (heating && currentTemp > temp) {
-      if (time - t2 > (act->type == IS_HOTEND ? 2500 : 1500)) {
-        heating = false;
+  const millis_l time = millis();
+  const float currentTemp = act->current_temperature;
+  NOLESS(at.maxTemp, currentTemp);
+  NOMORE(at.minTemp, currentTemp);
 
-        act->soft_pwm = (bias - d);
+  if (at.heating && currentTemp > at.temp) {
+    if (time - at.t2 > (act->type == IS_HOTEND ? 2500 : 1500)) {
+      at.heating = false;
 
-        t1 = time;
-        t_high = t1 - t2;
+      act->soft_pwm = (at.bias - at.d);
 
-        #if HAS_TEMP_COOLER
-          if (act->type == IS_COOLER)
-            minTemp = temp;
-          else
-        #endif
-          maxTemp = temp;
-      }
+      at.t1 = time;
+      at.t_high = at.t1 - at.t2;
+
+      #if HAS_TEMP_COOLER
+        if (act->type == IS_COOLER)
+          at.minTemp = at.temp;
+        else
+      #endif
+        at.maxTemp = at.temp;
     }
+  }
 
-    if (!heating && currentTemp < temp) {
-      if (time - t1 > (act->type == IS_HOTEND ? 5000 : 3000)) {
-        heating = true;
-        t2 = time;
-        t_low = t2 - t1;
-        if (cycles > 0) {
-
-          bias += (d * (t_high - t_low)) / (t_low + t_high);
-          bias = constrain(bias, 20, pidMax - 20);
-          d = (bias > pidMax / 2) ? pidMax - 1 - bias : bias;
-
-          SERIAL_MV(MSG_BIAS, bias);
-          SERIAL_MV(MSG_D, d);
-          SERIAL_MV(MSG_T_MIN, minTemp, 2);
-          SERIAL_EMV(MSG_T_MAX, maxTemp, 2);
-          if (cycles > 2) {
-            Ku = (4.0 * d) / (M_PI * (maxTemp - minTemp));
-            Tu = ((float)(t_low + t_high) * 0.001);
-            SERIAL_MV(MSG_KU, Ku, 2);
-            SERIAL_EMV(MSG_TU, Tu, 2);
-
-            if (method == 0) {
-              workKp = 0.6 * Ku;
-              workKi = workKp * 2.0 / Tu;
-              workKd = workKp * Tu * 0.125;
-              SERIAL_EM(MSG_CLASSIC_PID);
-            }
-            else if (method == 1) {
-              workKp = 0.33 * Ku;
-              workKi = workKp * 2.0 / Tu;
-              workKd = workKp * Tu / 3.0;
-              SERIAL_EM(MSG_SOME_OVERSHOOT_PID);
-            }
-            else if (method == 2) {
-              workKp = 0.2 * Ku;
-              workKi = workKp * 2.0 / Tu;
-              workKd = workKp * Tu / 3.0;
-              SERIAL_EM(MSG_NO_OVERSHOOT_PID);
-            }
-            else if (method == 3) {
-              workKp = 0.7 * Ku;
-              workKi = workKp * 2.5 / Tu;
-              workKd = workKp * Tu * 3.0 / 20.0;
-              SERIAL_EM(MSG_PESSEN_PID);
-            }
-            else if (method == 4) {
-              workKp = 0.4545f * Ku;
-              workKi = workKp / Tu / 2.2f;
-              workKd = workKp * Tu / 6.3f;
-              SERIAL_EM(MSG_TYREUS_LYBEN_PID);
-            }
-            SERIAL_EMV(MSG_KP, workKp, 2);
-            SERIAL_EMV(MSG_KI, workKi, 2);
-            SERIAL_EMV(MSG_KD, workKd, 2);
+  if (!at.heating && currentTemp < at.temp) {
+    if (time - at.t1 > (act->type == IS_HOTEND ? 5000 : 3000)) {
+      at.heating = true;
+      at.t2 = time;
+      at.t_low = at.t2 - at.t1;
+      if (at.cycles > 0) {
+
+        const uint8_t pidMax = act->pidMax;
+
+        at.bias += (at.d * (at.t_high - at.t_low)) / (at.t_low + at.t_high);
+        at.bias = constrain(at.bias, 20, pidMax - 20);
+        at.d = (at.bias > pidMax / 2) ? pidMax - 1 - at.bias : at.bias;
+
+        SERIAL_MV(MSG_PID_AUTOTUNE " H", autotune_heater_code(act));
+        SERIAL_MV(" cycle:", (int)at.cycles);
+        SERIAL_MV(MSG_BIAS, at.bias);
+        SERIAL_MV(MSG_D, at.d);
+        SERIAL_MV(MSG_T_MIN, at.minTemp, 2);
+        SERIAL_EMV(MSG_T_MAX, at.maxTemp, 2);
+        if (at.cycles > 2) {
+          const float Ku = (4.0 * at.d) / (M_PI * (at.maxTemp - at.minTemp)),
+                      Tu = ((float)(at.t_low + at.t_high) * 0.001);
+          SERIAL_MV(MSG_KU, Ku, 2);
+          SERIAL_EMV(MSG_TU, Tu, 2);
+
+          if (at.method == 0) {
+            at.Kp = 0.6 * Ku;
+            at.Ki = at.Kp * 2.0 / Tu;
+            at.Kd = at.Kp * Tu * 0.125;
+            SERIAL_EM(MSG_CLASSIC_PID);
+          }
+          else if (at.method == 1) {
+            at.Kp = 0.33 * Ku;
+            at.Ki = at.Kp * 2.0 / Tu;
+            at.Kd = at.Kp * Tu / 3.0;
+            SERIAL_EM(MSG_SOME_OVERSHOOT_PID);
+          }
+          else if (at.method == 2) {
+            at.Kp = 0.2 * Ku;
+            at.Ki = at.Kp * 2.0 / Tu;
+            at.Kd = at.Kp * Tu / 3.0;
+            SERIAL_EM(MSG_NO_OVERSHOOT_PID);
           }
+          else if (at.method == 3) {
+            at.Kp = 0.7 * Ku;
+            at.Ki = at.Kp * 2.5 / Tu;
+            at.Kd = at.Kp * Tu * 3.0 / 20.0;
+            SERIAL_EM(MSG_PESSEN_PID);
+          }
+          else if (at.method == 4) {
+            at.Kp = 0.4545f * Ku;
+            at.Ki = at.Kp / Tu / 2.2f;
+            at.Kd = at.Kp * Tu / 6.3f;
+            SERIAL_EM(MSG_TYREUS_LYBEN_PID);
+          }
+          SERIAL_EMV(MSG_KP, at.Kp, 2);
+          SERIAL_EMV(MSG_KI, at.Ki, 2);
+          SERIAL_EMV(MSG_KD, at.Kd, 2);
         }
+      }
 
-        act->soft_pwm = (bias + d);
-
-        cycles++;
+      act->soft_pwm = (at.bias + at.d);
 
-        #if HAS_TEMP_COOLER
-          if (act->type == IS_COOLER)
-            maxTemp = temp;
-          else
-        #endif
-          minTemp = temp;
-      }
-    }
+      at.cycles++;
 
-    #if DISABLED(MAX_OVERSHOOT_PID_AUTOTUNE)
-      #define MAX_OVERSHOOT_PID_AUTOTUNE 20
-    #endif
-    if (currentTemp > temp + MAX_OVERSHOOT_PID_AUTOTUNE
       #if HAS_TEMP_COOLER
-        && act->type != IS_COOLER
+        if (act->type == IS_COOLER)
+          at.maxTemp = at.temp;
+        else
       #endif
-    ) {
-      SERIAL_LM(ER, MSG_PID_TEMP_TOO_HIGH);
-      LCD_ALERTMESSAGEPGM(MSG_PID_TEMP_TOO_HIGH);
-		#if ENABLED(NEXTION_HMI)
-			NextionHMI::RaiseEvent(HMIevent::ERROR, 0, MSG_PID_TEMP_TOO_HIGH);
-		#endif
-      pid_pointer = 255;
-      break;
+        at.minTemp = at.temp;
+
+      lcd_status_printf_P(0, PSTR(MSG_PID_AUTOTUNE " H%i %i/%i"), (int)autotune_heater_code(act), (int)at.cycles, (int)at.ncycles);
     }
-    #if HAS_TEMP_COOLER
-      else if (currentTemp < temp + MAX_OVERSHOOT_PID_AUTOTUNE && act->type == IS_COOLER) {
-        SERIAL_LM(ER, MSG_PID_TEMP_TOO_LOW);
-        LCD_ALERTMESSAGEPGM(MSG_PID_TEMP_TOO_LOW);
-		#if ENABLED(NEXTION_HMI)
-			NextionHMI::RaiseEvent(HMIevent::ERROR, 0, MSG_PID_TEMP_TOO_LOW);
-		#endif
-        pid_pointer = 255;
-        break;
-      }
-    #endif
+  }
 
-    // Timeout after MAX_CYCLE_TIME_PID_AUTOTUNE minutes since the last undershoot/overshoot cycle
-    #if DISABLED(MAX_CYCLE_TIME_PID_AUTOTUNE)
-      #define MAX_CYCLE_TIME_PID_AUTOTUNE 20L
+  #if DISABLED(MAX_OVERSHOOT_PID_AUTOTUNE)
+    #define MAX_OVERSHOOT_PID_AUTOTUNE 20
+  #endif
+  if (currentTemp > at.temp + MAX_OVERSHOOT_PID_AUTOTUNE
+    #if HAS_TEMP_COOLER
+      && act->type != IS_COOLER
     #endif
-    if (((time - t1) + (time - t2)) > (MAX_CYCLE_TIME_PID_AUTOTUNE * 60L * 1000L)) {
-      SERIAL_LM(ER, MSG_PID_TIMEOUT);
-      LCD_ALERTMESSAGEPGM(MSG_PID_TIMEOUT);
-		#if ENABLED(NEXTION_HMI)
-			NextionHMI::RaiseEvent(HMIevent::ERROR, 0, MSG_PID_TIMEOUT);
-		#endif
-      pid_pointer = 255;
-      break;
+  ) {
+    autotune_stop(act, PSTR(MSG_PID_TEMP_TOO_HIGH));
+    return;
+  }
+  #if HAS_TEMP_COOLER
+    else if (currentTemp < at.temp + MAX_OVERSHOOT_PID_AUTOTUNE && act->type == IS_COOLER) {
+      autotune_stop(act, PSTR(MSG_PID_TEMP_TOO_LOW));
+      return;
     }
+  #endif
 
-    if (cycles > ncycles) {
-
-      SERIAL_EM(MSG_PID_AUTOTUNE_FINISHED);
-      pid_pointer = 255;
+  // Timeout after MAX_CYCLE_TIME_PID_AUTOTUNE minutes since the last undershoot/overshoot cycle
+  #if DISABLED(MAX_CYCLE_TIME_PID_AUTOTUNE)
+    #define MAX_CYCLE_TIME_PID_AUTOTUNE 20L
+  #endif
+  if (((time - at.t1) + (time - at.t2)) > (MAX_CYCLE_TIME_PID_AUTOTUNE * 60L * 1000L)) {
+    autotune_stop(act, PSTR(MSG_PID_TIMEOUT));
+    return;
+  }
 
-      if (act->type == IS_HOTEND) {
-        SERIAL_MV(MSG_KP, workKp);
-        SERIAL_MV(MSG_KI, workKi);
-        SERIAL_EMV(MSG_KD, workKd);
-      }
+  if (at.cycles > at.ncycles) {
 
-      #if HAS_TEMP_BED
-        if (act->type == IS_BED) {
-          SERIAL_EMV("#define DEFAULT_bedKp ", workKp);
-          SERIAL_EMV("#define DEFAULT_bedKi ", workKi);
-          SERIAL_EMV("#define DEFAULT_bedKd ", workKd);
-        }
-      #endif
+    SERIAL_MV(MSG_PID_AUTOTUNE " H", autotune_heater_code(act));
+    SERIAL_EM(": " MSG_PID_AUTOTUNE_FINISHED);
 
-      #if HAS_TEMP_CHAMBER
-        if (act->type == IS_CHAMBER) {
-          SERIAL_EMV("#define DEFAULT_chamberKp ", workKp);
-          SERIAL_EMV("#define DEFAULT_chamberKi ", workKi);
-          SERIAL_EMV("#define DEFAULT_chamberKd ", workKd);
-        }
-      #endif
+    if (act->type == IS_HOTEND) {
+      SERIAL_MV(MSG_KP, at.Kp);
+      SERIAL_MV(MSG_KI, at.Ki);
+      SERIAL_EMV(MSG_KD, at.Kd);
+    }
 
-      #if HAS_TEMP_COOLER
-        if (act->type == IS_COOLER) {
-          SERIAL_EMV("#define DEFAULT_coolerKp ", workKp);
-          SERIAL_EMV("#define DEFAULT_coolerKi ", workKi);
-          SERIAL_EMV("#define DEFAULT_coolerKd ", workKd);
-        }
-      #endif
+    #if HAS_TEMP_BED
+      if (act->type == IS_BED) {
+        SERIAL_EMV("#define DEFAULT_bedKp ", at.Kp);
+        SERIAL_EMV("#define DEFAULT_bedKi ", at.Ki);
+        SERIAL_EMV("#define DEFAULT_bedKd ", at.Kd);
+      }
+    #endif
 
-      act->Kp = workKp;
-      act->Ki = workKi;
-      act->Kd = workKd;
-      act->setTuning(true);
-      act->updatePID();
+    #if HAS_TEMP_CHAMBER
+      if (act->type == IS_CHAMBER) {
+        SERIAL_EMV("#define DEFAULT_chamberKp ", at.Kp);
+        SERIAL_EMV("#define DEFAULT_chamberKi ", at.Ki);
+        SERIAL_EMV("#define DEFAULT_chamberKd ", at.Kd);
+      }
+    #endif
 
-      if (storeValues) eeprom.Store_Settings();
+    #if HAS_TEMP_COOLER
+      if (act->type == IS_COOLER) {
+        SERIAL_EMV("#define DEFAULT_coolerKp ", at.Kp);
+        SERIAL_EMV("#define DEFAULT_coolerKi ", at.Ki);
+        SERIAL_EMV("#define DEFAULT_coolerKd ", at.Kd);
+      }
+    #endif
 
-      break;
-    }
+    act->Kp = at.Kp;
+    act->Ki = at.Ki;
+    act->Kd = at.Kd;
 
-    #if ENABLED(NEXTION)
-      lcd_key_touch_update();
-    #else
-      lcd_update();
+    #if ENABLED(PID_FEEDFORWARD)
+      // The relay settles around the power that holds the temperature
+      if (act->type == IS_HOTEND && at.temp > 35) {
+        act->Kl = (float)at.bias / (at.temp - 25);
+        SERIAL_EMV(MSG_KL, act->Kl);
+      }
     #endif
 
+    act->setTuning(true);
+    act->updatePID();
+
+    autotune_stop(act);
+
+    if (at.store) eeprom.Store_Settings();
   }
 
-  LCD_MESSAGEPGM(WELCOME_MSG);
-  printer.setAutoreportTemp(oldReport);
-  disable_all_heaters();
+}
+
+/**
+ * Heater number as in M303 H
+ */
+int8_t Temperature::autotune_heater_code(const Heater *act) {
+  return act->type == IS_HOTEND ? (int8_t)act->ID : -(int8_t)act->type;
 }
 
 /**
@@ -600,7 +735,11 @@ void Temperature::disable_all_heaters() {
   // If all heaters go down then for sure our print job has stopped
   print_job_counter.stop();
 
-  pid_pointer = 255;
+  // Abort the autotunes
+  if (isAutotuning()) {
+    LOOP_HEATER() autotune[h].active = false;
+    printer.setAutoreportTemp(autotune_old_report);
+  }
 
 }
 
@@ -705,8 +844,105 @@ void Temperature::report_temperatures(const bool showRaw/*=false*/) {
   }
 #endif
 
+#if ENABLED(PARALLEL_HEATUP)
+
+  /**
+   * Set now the targets of the temperature commands queued right after
+   * the running one, so the heaters warm up together instead of one
+   * after the other. The scan stops at the first command of another kind.
+   */
+  void Temperature::start_queued_heaters() {
+
+    if (printer.debugDryrun() || printer.debugSimulation()) return;
+
+    #if ENABLED(TEMPERATURE_UNITS_SUPPORT)
+      if (parser.input_temp_units != TEMPUNIT_C) return;
+    #endif
+
+    for (uint8_t i = 0; i < commands.buffer_ring.count(); i++) {
+
+      const char *p = commands.queued_line(i);
+      int16_t code;
+      if (commands.peek_command(p, code) != 'M') return;
+
+      int8_t h = -1;
+      switch (code) {
+        case 105: case 117: continue; // Nothing to heat, look further
+        #if HAS_TEMP_HOTEND
+          case 104: case 109: h = EXTRUDER_IDX; break;
+        #endif
+        #if HAS_TEMP_BED
+          case 140: case 190: h = BED_INDEX; break;
+        #endif
+        #if HAS_TEMP_CHAMBER
+          case 141: case 191: h = CHAMBER_INDEX; break;
+        #endif
+        default: return;
+      }
+
+      const bool hotend = (code == 104 || code == 109);
+
+      int16_t temp = 0;
+      long value;
+      char c;
+      while ((c = commands.peek_param(p, value))) {
+        if (c == 'S') temp = value;
+        else if (c == 'T' && hotend)
+          h = (value < 0 || value >= EXTRUDERS) ? -1 : HOTENDS > 1 ? value : 0;
+      }
+
+      // Only switch on, the commands switching off run at their time
+      if (h < 0 || (hotend && h >= HOTENDS) || temp <= 0) continue;
+      if (heaters[h].target_temp_nocorr != temp) heaters[h].setTarget(temp);
+    }
+  }
+
+#endif // PARALLEL_HEATUP
+
+#if ENABLED(HEATER_POWER_BUDGET)
+
+  /**
+   * Scale the PWM of the heaters when all together they ask for more
+   * than HEATER_POWER_BUDGET. A running autotune keeps its own output.
+   */
+  void Temperature::limit_heater_power() {
+
+    uint32_t  demand    = 0,
+              reserved  = 0;
+
+    LOOP_HEATER() {
+      Heater *act = &heaters[h];
+      act->setPowerLimited(false);
+      const uint32_t power = (uint32_t)act->soft_pwm * (act->type == IS_HOTEND ? hotend_power[h] : heater_power[act->type]);
+      if (autotune[h].active) reserved += power;
+      else demand += power;
+    }
+
+    const uint32_t budget = (uint32_t)(HEATER_POWER_BUDGET) * (PID_MAX);
+    if (demand + reserved <= budget) return;
+
+    const uint32_t left = budget > reserved ? budget - reserved : 0;
+    LOOP_HEATER() {
+      if (!autotune[h].active && heaters[h].soft_pwm) {
+        heaters[h].soft_pwm = (uint32_t)heaters[h].soft_pwm * left / demand;
+        // Integrator held while the output is cut, no overshoot when released
+        heaters[h].setPowerLimited(true);
+      }
+    }
+  }
+
+#endif // HEATER_POWER_BUDGET
+
 // Temperature Error Handlers
 void Temperature::_temp_error(const uint8_t h, const char * const serial_msg, const char * const lcd_msg) {
+
+  #if HAS_THERMAL_LOG
+    thermallog.freeze(h);
+  #endif
+
+  // The autotune drives soft_pwm itself, the idle heater would keep its output
+  if (autotune[h].active) autotune_stop(&heaters[h]);
+
   if (!heaters[h].isIdle()) {
 	tempError = true;
     SERIAL_STR(ER);
@@ -838,6 +1074,9 @@ void Temperature::max_temp_error(const uint8_t h) {
     	char buff[50];
 		sprintf_P(buff, PSTR("%s. T:%.1f/%.1f idle:%d"),MSG_T_THERMAL_RUNAWAY, temperature, target_temperature, heaters[h].isIdle());
     	NextionHMI::RaiseEvent(HMIevent::TEMPERATURE_ERROR, h, buff);
+    	#if HAS_THERMAL_LOG
+    	  thermallog.freeze(h);
+    	#endif
     	heaters[h].setIdle(true);
        // _temp_error(h, PSTR(MSG_T_THERMAL_RUNAWAY), PSTR(MSG_THERMAL_RUNAWAY));
 #else
@@ -59,7 +59,29 @@ class Temperature {
 
   private: /** Private Parameters */
 
-    static uint8_t pid_pointer;
+    typedef struct {
+      bool      active,
+                heating,
+                store;
+      uint8_t   method,
+                cycles,
+                ncycles;
+      float     temp,
+                maxTemp,
+                minTemp,
+                Kp,
+                Ki,
+                Kd;
+      int32_t   bias,
+                d,
+                t_high,
+                t_low;
+      millis_l  t1,
+                t2;
+    } autotune_t;
+
+    static autotune_t autotune[HEATER_COUNT];
+    static bool       autotune_old_report;
 
     static millis_l next_check_ms[HEATER_COUNT];
 
@@ -80,6 +102,7 @@ class Temperature {
      * Static (class) methods
      */
     static void wait_heater(Heater *act, bool no_wait_for_cooling=true);
+    static void wait_all_heaters();
 
     /**
      * Called from the Temperature ISR
@@ -91,10 +114,24 @@ class Temperature {
      */
     static void spin();
 
+    #if HEATER_USES_MAX
+      /**
+       * Call from the idle loop to sample the SPI sensors
+       */
+      static void spin_spi_sensors();
+    #endif
+
     /**
-     * Perform auto-tuning for hotend, bed, chamber or cooler in response to M303
+     * Start auto-tuning for hotend, bed, chamber or cooler in response to M303
      */
     static void PID_autotune(Heater *act, const float temp, const uint8_t ncycles, const uint8_t method, const bool storeValues=false);
+    static void autotune_stop(Heater *act, PGM_P const error=NULL);
+
+    FORCE_INLINE static bool isAutotuning(const uint8_t h) { return autotune[h].active; }
+    FORCE_INLINE static bool isAutotuning() {
+      LOOP_HEATER() if (autotune[h].active) return true;
+      return false;
+    }
 
     /**
      * Switch off all heaters, set all target temperatures to 0
@@ -156,6 +193,21 @@ class Temperature {
     static void min_temp_error(const uint8_t h);
     static void max_temp_error(const uint8_t h);
 
+    static void autotune_step(Heater *act);
+    static int8_t autotune_heater_code(const Heater *act);
+
+    #if ENABLED(PARALLEL_HEATUP)
+      static void start_queued_heaters();
+    #endif
+
+    #if ENABLED(HEATER_POWER_BUDGET)
+      static void limit_heater_power();
+    #endif
+
+    #if TEMP_RESIDENCY_TIME > 0
+      static bool check_residency(millis_l &residency_start_ms, const float temp_diff, const millis_l now);
+    #endif
+
     #if HAS_THERMALLY_PROTECTED_HEATER
 
       typedef enum TRState { TRInactive, TRFirstHeating, TRStable, TRRunaway } TRstate;
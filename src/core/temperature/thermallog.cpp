@@ -0,0 +1,155 @@
+/**
+ * MK4duo Firmware for 3D Printer, Laser and CNC
+ *
+ * Based on Marlin, Sprinter and grbl
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ * Copyright (C) 2013 Alberto Cotronei @MagoKimbra
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../MK4duo.h"
+
+#if HAS_THERMAL_LOG
+
+  ThermalLog thermallog;
+
+  bool      ThermalLog::frozen        = false;
+
+  uint8_t   ThermalLog::interval      = THERMAL_LOG_INTERVAL;
+
+  int8_t    ThermalLog::error_heater  = -1;
+
+  uint16_t  ThermalLog::head          = 0,
+            ThermalLog::count         = 0;
+
+  millis_l  ThermalLog::last_ms       = 0;
+
+  thermal_sample_t ThermalLog::samples[THERMAL_LOG_SIZE][HEATER_COUNT];
+  uint16_t         ThermalLog::delta_ms[THERMAL_LOG_SIZE];
+
+  /**
+   * Public Function
+   */
+
+  // Called by the temperature cycle, nominally every 100ms
+  void ThermalLog::spin() {
+    if (frozen || !interval) return;
+    if (count && PENDING(millis(), last_ms + interval * 100UL)) return;
+    sample();
+  }
+
+  void ThermalLog::freeze(const uint8_t h) {
+    if (frozen) return;
+    // Keep the reading that caused the error
+    sample();
+    frozen = true;
+    error_heater = h;
+    SERIAL_LMV(ECHO, "Thermal log stopped, M156 D1 to read it. Heater ", (int)h);
+  }
+
+  void ThermalLog::clear() {
+    head = count = 0;
+    error_heater = -1;
+    frozen = false;
+  }
+
+  void ThermalLog::set_interval(const uint8_t cycles) {
+    // Keep the rows, each one has its own distance from the one before
+    interval = cycles;
+  }
+
+  void ThermalLog::report() {
+    SERIAL_SMV(ECHO, "Thermal log N", count);
+    SERIAL_MV("/", THERMAL_LOG_SIZE);
+    SERIAL_MV(" I", (int)interval * 100);
+    SERIAL_MSG(frozen ? " stopped" : interval ? " running" : " paused");
+    if (error_heater >= 0) SERIAL_MV(" E", (int)error_heater);
+    SERIAL_EOL();
+  }
+
+  void ThermalLog::dump(const bool binary) {
+
+    SERIAL_MV("tlog:start N", count);
+    SERIAL_MV(" H", HEATER_COUNT);
+    SERIAL_MV(" I", (int)interval * 100);
+    SERIAL_MV(" A", (uint32_t)(count ? millis() - last_ms : 0));
+    SERIAL_EMV(" E", (int)error_heater);
+
+    // Oldest row first
+    uint16_t row = (head + THERMAL_LOG_SIZE - count) % THERMAL_LOG_SIZE;
+
+    if (binary) {
+      SERIAL_EMV("tlog:bin ", (uint32_t)(count * (sizeof(delta_ms[0]) + sizeof(samples[0]))));
+      for (uint16_t r = 0; r < count; r++) {
+        const uint16_t delta = r ? delta_ms[row] : 0;
+        SERIAL_CHR(delta & 0xFF);
+        SERIAL_CHR(delta >> 8);
+        const uint8_t *data = (const uint8_t*)samples[row];
+        for (uint16_t b = 0; b < sizeof(samples[0]); b++) SERIAL_CHR(data[b]);
+        if (++row == THERMAL_LOG_SIZE) row = 0;
+      }
+      SERIAL_EOL();
+    }
+    else {
+      // Distance of the oldest row from the last one
+      uint32_t before = 0;
+      for (uint16_t r = 1, i = (row + 1) % THERMAL_LOG_SIZE; r < count; r++, i = (i + 1) % THERMAL_LOG_SIZE)
+        before += delta_ms[i];
+
+      for (uint16_t r = 0; r < count; r++) {
+        if (r) before -= delta_ms[row];
+        SERIAL_VAL(-(long)before);
+        LOOP_HEATER() {
+          const thermal_sample_t &s = samples[row][h];
+          SERIAL_CHR(',');
+          SERIAL_VAL(s.temperature * 0.1f, 1);
+          SERIAL_CHR(',');
+          SERIAL_VAL((int)s.target);
+          SERIAL_CHR(',');
+          SERIAL_VAL((int)s.pwm);
+          SERIAL_CHR(',');
+          SERIAL_VAL((int)s.raw);
+        }
+        SERIAL_EOL();
+        if (++row == THERMAL_LOG_SIZE) row = 0;
+      }
+    }
+
+    SERIAL_EM("tlog:end");
+  }
+
+  /**
+   * Private Function
+   */
+  void ThermalLog::sample() {
+    thermal_sample_t *s = samples[head];
+    LOOP_HEATER() {
+      const Heater *act = &heaters[h];
+      s[h].temperature  = act->current_temperature * 10;
+      s[h].target       = act->target_temperature;
+      s[h].raw          = act->sensor.raw;
+      s[h].pwm          = act->soft_pwm;
+      s[h].pad          = 0;
+    }
+    const millis_l now = millis(),
+                   delta = count ? now - last_ms : 0;
+    delta_ms[head] = delta > 0xFFFF ? 0xFFFF : delta;
+    if (++head == THERMAL_LOG_SIZE) head = 0;
+    if (count < THERMAL_LOG_SIZE) count++;
+    last_ms = now;
+  }
+
+#endif // HAS_THERMAL_LOG
@@ -0,0 +1,98 @@
+/**
+ * MK4duo Firmware for 3D Printer, Laser and CNC
+ *
+ * Based on Marlin, Sprinter and grbl
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ * Copyright (C) 2013 Alberto Cotronei @MagoKimbra
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * thermallog.h - Ring buffer of the last heater samples
+ *
+ * Every THERMAL_LOG_INTERVAL * 100ms a row with one sample for each heater is written
+ * over the oldest one. A late temperature cycle delays the row, so every row keeps the
+ * ms since the one before. The first heater error, thermal runaway included, stops the
+ * log, so the rows leading to the fault stay there until M156 R.
+ *
+ * The dump starts with the line
+ *
+ *   tlog:start N<rows> H<heaters> I<nominal ms between rows> A<ms since the last row> E<heater stopped the log, -1 none>
+ *
+ * then, oldest row first, either CSV lines (M156 D1)
+ *
+ *   <ms before the last row>,<temp>,<target>,<pwm>,<raw>,<temp>,<target>,<pwm>,<raw>,...
+ *
+ * or, after "tlog:bin <bytes>", the rows (M156 D2): ms since the row before (uint16,
+ * 0 for the first row kept), then for each heater temperature in tenths of degree (int16),
+ * target (int16), raw ADC (int16), PWM (uint8) and a pad byte, little endian.
+ * The dump ends with "tlog:end".
+ */
+
+#ifndef _THERMALLOG_H_
+#define _THERMALLOG_H_
+
+#if HAS_THERMAL_LOG
+
+  typedef struct {
+    int16_t temperature,  // Tenths of degree
+            target,
+            raw;
+    uint8_t pwm,
+            pad;
+  } thermal_sample_t;
+
+  class ThermalLog {
+
+    public: /** Constructor */
+
+      ThermalLog() {}
+
+    public: /** Public Parameters */
+
+      static bool     frozen;
+      static uint8_t  interval;
+      static int8_t   error_heater;
+
+    private: /** Private Parameters */
+
+      static uint16_t head,
+                      count;
+      static millis_l last_ms;
+
+      static thermal_sample_t samples[THERMAL_LOG_SIZE][HEATER_COUNT];
+      static uint16_t         delta_ms[THERMAL_LOG_SIZE];   // ms since the row before
+
+    public: /** Public Function */
+
+      static void spin();
+      static void freeze(const uint8_t h);
+      static void clear();
+      static void set_interval(const uint8_t cycles);
+      static void report();
+      static void dump(const bool binary);
+
+    private: /** Private Function */
+
+      static void sample();
+
+  };
+
+  extern ThermalLog thermallog;
+
+#endif // HAS_THERMAL_LOG
+
+#endif /* _THERMALLOG_H_ */
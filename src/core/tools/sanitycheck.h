@@ -215,4 +215,25 @@ static_assert(1 >= 0
   #error "DEPENDENCY ERROR: You must set EXTRUDERS = 2 for DONDOLO."
 #endif
 
+#if ENABLED(SWITCH_TEST)
+  #if DISABLED(SWITCH_TEST_LOG_SIZE)
+    #error "DEPENDENCY ERROR: Missing setting SWITCH_TEST_LOG_SIZE."
+  #elif SWITCH_TEST_LOG_SIZE < 1
+    #error "DEPENDENCY ERROR: SWITCH_TEST_LOG_SIZE must be at least 1."
+  #endif
+#endif
+
+#if DISABLED(PLASTIC_DENSITY)
+  #error "DEPENDENCY ERROR: Missing setting PLASTIC_DENSITY."
+#endif
+
+#if ENABLED(EG6_EXTRUDER) && (DISABLED(CHANGE_MOVES_MIN_POS) || DISABLED(CHANGE_MOVES_MAX_POS))
+  #error "DEPENDENCY ERROR: Missing setting CHANGE_MOVES_MIN_POS or CHANGE_MOVES_MAX_POS."
+#endif
+
+// The switch path is planned with Mechanics::queue_move_to, straight lines with no kinematics
+#if ENABLED(EG6_EXTRUDER) && !(IS_CARTESIAN || IS_CORE)
+  #error "EG6_EXTRUDER is only supported by CARTESIAN and CORE mechanics."
+#endif
+
 #endif /* _TOOLS_SANITYCHECK_H_ */
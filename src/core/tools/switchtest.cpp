@@ -0,0 +1,291 @@
+/**
+ * MK4duo Firmware for 3D Printer, Laser and CNC
+ *
+ * Based on Marlin, Sprinter and grbl
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ * Copyright (C) 2013 Alberto Cotronei @MagoKimbra
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../MK4duo.h"
+
+#if HAS_SWITCH_TEST
+
+  SwitchTest switchtest;
+
+  bool      SwitchTest::running         = false,
+            SwitchTest::pending         = false,
+            SwitchTest::checked         = false;
+
+  uint16_t  SwitchTest::check_every     = 0,
+            SwitchTest::time_limit      = 0,
+            SwitchTest::max_time        = 0,
+            SwitchTest::head            = 0,
+            SwitchTest::count           = 0;
+
+  uint32_t  SwitchTest::cycles          = 0,
+            SwitchTest::max_cycles      = 0,
+            SwitchTest::total_time      = 0;
+
+  float     SwitchTest::deviation_limit = 0.0,
+            SwitchTest::deviation[2]    = { 0.0 };
+
+  millis_l  SwitchTest::start_ms        = 0,
+            SwitchTest::stop_ms         = 0,
+            SwitchTest::pending_ms      = 0;
+
+  PGM_P     SwitchTest::stop_reason     = NULL;
+
+  switch_sample_t SwitchTest::samples[SWITCH_TEST_LOG_SIZE];
+
+  /**
+   * Public Function
+   */
+
+  void SwitchTest::start(const uint32_t switches, const uint16_t check, const float max_deviation, const uint16_t max_ms) {
+
+    if (running) return;
+
+    if (print_job_counter.isRunning() || IS_SD_PRINTING) {
+      SERIAL_LM(ER, "Switch test: not while printing");
+      return;
+    }
+
+    // The T commands change the tool only in this mode
+    if (printer.mode != PRINTER_MODE_FFF) {
+      SERIAL_LM(ER, "Switch test: FFF mode only");
+      return;
+    }
+
+    max_cycles      = switches;
+    check_every     = check;
+    deviation_limit = max_deviation;
+    time_limit      = max_ms;
+
+    cycles = total_time = 0;
+    max_time = head = count = 0;
+    deviation[X_AXIS] = deviation[Y_AXIS] = 0.0;
+    pending = checked = false;
+    stop_reason = NULL;
+    start_ms = stop_ms = millis();
+
+    // Only the errors from now on stop the test
+    Temperature::tempError = false;
+
+    running = true;
+
+    SERIAL_LM(ECHO, "Switch test started");
+    #if ENABLED(NEXTION_HMI)
+      StateMessage::ActivatePGM(MESSAGE_CRITICAL_ERROR, NEX_ICON_WARNING, PSTR("Switch Test"), PSTR("0"), 0, 0, 0, 0, 0);
+    #endif
+  }
+
+  void SwitchTest::stop(PGM_P const reason) {
+    if (!running) return;
+    running = pending = false;
+    stop_reason = reason;
+    stop_ms = millis();
+    report();
+    show_message();
+  }
+
+  // Called by the scheduler
+  void SwitchTest::spin() {
+
+    if (!running) return;
+
+    if (Temperature::tempError) {
+      stop(PSTR("heater error"));
+      return;
+    }
+
+    // One command at a time, the next when the last is done
+    if (pending) {
+      // A T that changes nothing never calls tool_changed()
+      const millis_l wait = max((millis_l)max_time * SWITCH_TEST_WAIT_SLOW, (millis_l)SWITCH_TEST_WAIT_MIN);
+      if (ELAPSED(millis(), pending_ms + wait)) stop(PSTR("no tool change"));
+      return;
+    }
+
+    char cmd[10];
+    if (check_every && cycles && !(cycles % check_every) && !checked)
+      strcpy_P(cmd, PSTR("M1012 H"));
+    else
+      sprintf_P(cmd, PSTR("T%i"), (int)((tools.active_extruder + 1) % EXTRUDERS));
+
+    if (commands.enqueue(cmd)) {
+      pending = true;
+      pending_ms = millis();
+    }
+  }
+
+  // Called at the end of every tool change
+  void SwitchTest::tool_changed(const millis_l time) {
+
+    if (!running || !pending) return;
+    pending = false;
+
+    const uint16_t ms = time > 0xFFFF ? 0xFFFF : time;
+    cycles++;
+    total_time += ms;
+    NOLESS(max_time, ms);
+
+    switch_sample_t &s = samples[head];
+    s.time = ms;
+    LOOP_XY(axis) s.deviation[axis] = checked ? deviation[axis] * 1000 : SWITCH_TEST_NO_CHECK;
+    LOOP_HOTEND() s.temperature[h] = heaters[h].current_temperature * 10;
+    if (++head == SWITCH_TEST_LOG_SIZE) head = 0;
+    if (count < SWITCH_TEST_LOG_SIZE) count++;
+    checked = false;
+
+    if (time_limit && ms > time_limit)
+      stop(PSTR("switch too slow"));
+    else if (max_cycles && cycles >= max_cycles)
+      stop(PSTR("done"));
+    else
+      show_message();
+  }
+
+  void SwitchTest::check_endstops() {
+
+    #if IS_CARTESIAN || IS_CORE
+
+      if (mechanics.axis_unhomed_error(true, true, false)) {
+        stop(PSTR("axes not homed"));
+        return;
+      }
+
+      stepper.synchronize();
+
+      const float x = mechanics.current_position[X_AXIS],
+                  y = mechanics.current_position[Y_AXIS];
+
+      printer.setup_for_endstop_or_probe_move();
+      endstops.setEnabled(true);
+
+      bool reached = true;
+
+      LOOP_XY(axis) {
+        const float bump = mechanics.home_dir[axis] * mechanics.home_bump_mm[axis],
+                    near = mechanics.base_home_pos[axis] - bump;
+
+        // HOME_BUMP_MM away from the endstop, then back until it triggers
+        if (axis == X_AXIS)
+          mechanics.do_blocking_move_to_xy(near, mechanics.current_position[Y_AXIS]);
+        else
+          mechanics.do_blocking_move_to_xy(mechanics.current_position[X_AXIS], near);
+
+        mechanics.do_homing_move((AxisEnum)axis, 2 * bump, mechanics.get_homing_bump_feedrate((AxisEnum)axis));
+
+        // The homing move starts from 0
+        const float run = stepper.get_axis_position_mm((AxisEnum)axis) * mechanics.home_dir[axis];
+        if (run >= 2 * mechanics.home_bump_mm[axis] - 0.01) reached = false;
+        deviation[axis] = run - mechanics.home_bump_mm[axis];
+
+        mechanics.set_axis_is_at_home((AxisEnum)axis);
+        mechanics.sync_plan_position();
+      }
+
+      endstops.setNotHoming();
+
+      mechanics.do_blocking_move_to_xy(x, y);
+
+      printer.clean_up_after_endstop_or_probe_move();
+
+      SERIAL_SMV(ECHO, "Endstop deviation X:", deviation[X_AXIS], 3);
+      SERIAL_EMV(" Y:", deviation[Y_AXIS], 3);
+
+      if (!running) return;
+
+      pending = false;
+      checked = true;
+
+      if (!reached)
+        stop(PSTR("endstop not reached"));
+      else if (deviation_limit > 0 && (FABS(deviation[X_AXIS]) > deviation_limit || FABS(deviation[Y_AXIS]) > deviation_limit))
+        stop(PSTR("endstop deviation"));
+
+    #else
+
+      SERIAL_LM(ER, "Switch test: no endstop check for this mechanism");
+      stop(PSTR("no endstop check"));
+
+    #endif
+  }
+
+  void SwitchTest::report() {
+    const millis_l elapsed = (running ? millis() : stop_ms) - start_ms;
+    SERIAL_SMV(ECHO, "Switch test C", cycles);
+    if (max_cycles) SERIAL_MV("/", max_cycles);
+    SERIAL_MSG(running ? " running" : " stopped");
+    if (!running && stop_reason) {
+      SERIAL_MSG(" (");
+      SERIAL_PS(stop_reason);
+      SERIAL_CHR(')');
+    }
+    SERIAL_MV(" time:", (uint32_t)(elapsed / 1000));
+    SERIAL_MV("s avg:", cycles ? total_time / cycles : (uint32_t)0);
+    SERIAL_MV("ms max:", max_time);
+    SERIAL_MV("ms switches/h:", elapsed ? (uint32_t)(cycles * 3600000ULL / elapsed) : (uint32_t)0);
+    SERIAL_MV(" dev X:", deviation[X_AXIS], 3);
+    SERIAL_EMV(" Y:", deviation[Y_AXIS], 3);
+  }
+
+  void SwitchTest::dump() {
+
+    SERIAL_MV("stest:start N", count);
+    SERIAL_EMV(" C", cycles);
+
+    // Oldest row first
+    uint16_t row = (head + SWITCH_TEST_LOG_SIZE - count) % SWITCH_TEST_LOG_SIZE;
+
+    for (uint16_t r = 0; r < count; r++) {
+      const switch_sample_t &s = samples[row];
+      SERIAL_VAL(cycles - count + 1 + r);
+      SERIAL_CHR(',');
+      SERIAL_VAL((int)s.time);
+      LOOP_XY(axis) {
+        SERIAL_CHR(',');
+        if (s.deviation[axis] != SWITCH_TEST_NO_CHECK) SERIAL_VAL((int)s.deviation[axis]);
+      }
+      LOOP_HOTEND() {
+        SERIAL_CHR(',');
+        SERIAL_VAL(s.temperature[h] * 0.1f, 1);
+      }
+      SERIAL_EOL();
+      if (++row == SWITCH_TEST_LOG_SIZE) row = 0;
+    }
+
+    SERIAL_EM("stest:end");
+  }
+
+  /**
+   * Private Function
+   */
+  void SwitchTest::show_message() {
+    #if ENABLED(NEXTION_HMI)
+      if (running)
+        sprintf_P(NextionHMI::buffer, PSTR("%lu"), (unsigned long)cycles);
+      else {
+        strcpy_P(NextionHMI::buffer, PSTR("Stopped: "));
+        strcat_P(NextionHMI::buffer, stop_reason);
+        sprintf_P(NextionHMI::buffer + strlen(NextionHMI::buffer), PSTR(". T=%d. Switch number: %lu."), (int)heaters[0].current_temperature, (unsigned long)cycles);
+      }
+      StateMessage::UpdateMessage(NextionHMI::buffer);
+    #endif
+  }
+
+#endif // HAS_SWITCH_TEST
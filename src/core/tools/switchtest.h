@@ -0,0 +1,115 @@
+/**
+ * MK4duo Firmware for 3D Printer, Laser and CNC
+ *
+ * Based on Marlin, Sprinter and grbl
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ * Copyright (C) 2013 Alberto Cotronei @MagoKimbra
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * switchtest.h - Tool switch endurance test
+ *
+ * M1012 switches from one tool to the next with T commands put in the command
+ * queue, one at a time, so the switch moves are planned as in a print and the
+ * heaters, the display and the serial port keep running. Every switch writes a
+ * row over the oldest one with its time, the hotend temperatures and, after an
+ * endstop check, the X Y endstop deviation. The test stops after the given
+ * switches, on a heater error, on a switch slower or a deviation larger than
+ * the limits, on a queued command not done in time, or with M1012 X.
+ *
+ * The endstop check (M1012 H) moves each axis HOME_BUMP_MM away from its
+ * endstop and back at the bump feedrate. The deviation is the distance run to
+ * the endstop less HOME_BUMP_MM, then the axis is set at its home position.
+ *
+ * The dump (M1012 P) starts with the line
+ *
+ *   stest:start N<rows> C<switches done>
+ *
+ * then, oldest row first, CSV lines
+ *
+ *   <switch>,<ms>,<X deviation um>,<Y deviation um>,<temp>,<temp>,...
+ *
+ * with the deviations empty on the switches without check, and ends with "stest:end".
+ */
+
+#ifndef _SWITCHTEST_H_
+#define _SWITCHTEST_H_
+
+#if HAS_SWITCH_TEST
+
+  #define SWITCH_TEST_NO_CHECK  -32768
+  #define SWITCH_TEST_WAIT_MIN   60000UL  // ms, least wait for a queued command
+  #define SWITCH_TEST_WAIT_SLOW  5        // Times the slowest switch a queued command can wait
+
+  typedef struct {
+    uint16_t  time;                   // ms, switch moves included
+    int16_t   deviation[2],           // um, SWITCH_TEST_NO_CHECK without check
+              temperature[HOTENDS];   // Tenths of degree
+  } switch_sample_t;
+
+  class SwitchTest {
+
+    public: /** Constructor */
+
+      SwitchTest() {}
+
+    public: /** Public Parameters */
+
+      static bool running;
+
+    private: /** Private Parameters */
+
+      static bool     pending,          // A T or M1012 H queued and not done
+                      checked;          // Endstops checked since the last switch
+      static uint16_t check_every,
+                      time_limit,       // ms
+                      max_time,
+                      head,
+                      count;
+      static uint32_t cycles,
+                      max_cycles,
+                      total_time;       // ms
+      static float    deviation_limit,  // mm
+                      deviation[2];
+      static millis_l start_ms,
+                      stop_ms,
+                      pending_ms;       // The last command queued
+      static PGM_P    stop_reason;
+
+      static switch_sample_t samples[SWITCH_TEST_LOG_SIZE];
+
+    public: /** Public Function */
+
+      static void start(const uint32_t switches, const uint16_t check, const float max_deviation, const uint16_t max_ms);
+      static void stop(PGM_P const reason);
+      static void spin();
+      static void tool_changed(const millis_l time);
+      static void check_endstops();
+      static void report();
+      static void dump();
+
+    private: /** Private Function */
+
+      static void show_message();
+
+  };
+
+  extern SwitchTest switchtest;
+
+#endif // HAS_SWITCH_TEST
+
+#endif /* _SWITCHTEST_H_ */
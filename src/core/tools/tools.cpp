@@ -55,10 +55,24 @@
   uint8_t   Tools::cut_servo_id = 0;
   uint8_t   Tools::cut_neutral_angle = 0;
   uint8_t   Tools::cut_active_angle = 0;
+  uint16_t  Tools::cut_dwell = CUT_DWELL_TIME;
 
   bool Tools::fiber_is_cut = true;
   bool Tools::printing_with_fiber = false;
 
+  volatile bool Tools::fiber_feed_event = false,
+                Tools::fiber_cut_event  = false;
+  millis_l      Tools::fiber_feed_ms    = 0,
+                Tools::fiber_fed_time   = 0;
+
+  #if HAS_SERVOS
+    volatile bool     Tools::cut_opened_event   = false;
+    volatile uint8_t  Tools::cuts_queued        = 0;
+    volatile millis_l Tools::cut_hold_time      = 0,
+                      Tools::cut_open_ms        = 0;
+    bool              Tools::cut_servo_attached = false;
+  #endif
+
 #if ENABLED(EG6_EXTRUDER)
   ToolSwitchPos Tools::hotend_switch_path[HOTENDS][CHANGE_MOVES] = {0.0, 0.0, 0.0, false};
   float Tools::wipepark_return_position[XYZ] = {0, 0, 0};
@@ -94,7 +108,17 @@
 
         mechanics.feedrate_mm_s = fr_mm_s > 0.0 ? fr_mm_s : XY_PROBE_FEEDRATE_MM_S;
 
-        if ((tmp_extruder != active_extruder) || force) {
+        const bool changing = (tmp_extruder != active_extruder) || force;
+        const millis_l change_start_ms = millis();
+        float queued_time = 0.0;  // Seconds of the switch moves left in the planner
+
+        if (changing) {
+
+          #if HAS_HOTEND_STANDBY
+            // Bring the new hotend back from standby before moving to it
+            standby.tool_change(active_extruder, tmp_extruder);
+          #endif
+
           if (!no_move) {
         	 if (mechanics.axis_unhomed_error())
         	 {
@@ -188,14 +212,13 @@
         	  float additional_z_lift = 1.5;
 			  if (mechanics.destination[Z_AXIS]+additional_z_lift>(endstops.soft_endstop_max[Z_AXIS])) additional_z_lift = 0;
 
-        	  if (mechanics.destination[Z_AXIS]>mechanics.current_position[Z_AXIS])
-        	  {
-        		  mechanics.do_blocking_move_to_z(mechanics.destination[Z_AXIS]+additional_z_lift, mechanics.max_feedrate_mm_s[Z_AXIS]);
-        	  }
-        	  else
-        	  {
-        		  mechanics.do_blocking_move_to_z(mechanics.current_position[Z_AXIS]+additional_z_lift, mechanics.max_feedrate_mm_s[Z_AXIS]);
-        	  }
+        	  const float lift_z = max(mechanics.destination[Z_AXIS], mechanics.current_position[Z_AXIS]) + additional_z_lift;
+              #if ENABLED(EG6_EXTRUDER)
+                // Planned together with the switch path below
+                queued_time += mechanics.queue_move_to(mechanics.current_position[X_AXIS], mechanics.current_position[Y_AXIS], lift_z, mechanics.max_feedrate_mm_s[Z_AXIS]);
+              #else
+                mechanics.do_blocking_move_to_z(lift_z, mechanics.max_feedrate_mm_s[Z_AXIS]);
+              #endif
             #endif
             #if ENABLED(DEBUG_LEVELING_FEATURE)
               if (printer.debugLeveling()) DEBUG_POS("Move back", mechanics.destination);
@@ -204,14 +227,15 @@
 
             #if ENABLED(EG6_EXTRUDER)
               	float x_target, y_target;
-                //Making moves to physically switch extruder
+                //Making moves to physically switch extruder, all of them in the planner
+                //with the lift and the return, the look-ahead runs through the waypoints
                 for (uint8_t i=0; i<CHANGE_MOVES; i++)
                 {
                 	if (hotend_switch_path[active_extruder][i].Speed>0 && (hotend_switch_path[active_extruder][i].SwitchMove || clean))
                 	{
                 		x_target = hotend_switch_path[active_extruder][i].SwitchMove ? hotend_switch_path[active_extruder][i].X + tools.switch_offset_x : hotend_switch_path[active_extruder][i].X;
                 		y_target = hotend_switch_path[active_extruder][i].SwitchMove ? hotend_switch_path[active_extruder][i].Y + tools.switch_offset_y : hotend_switch_path[active_extruder][i].Y;
-						mechanics.do_blocking_move_to(
+						queued_time += mechanics.queue_move_to(
 								Mechanics::homeCS2toolCS(active_extruder, x_target, AxisEnum::X_AXIS),
 								Mechanics::homeCS2toolCS(active_extruder, y_target, AxisEnum::Y_AXIS),
 								mechanics.current_position[Z_AXIS],
@@ -222,13 +246,13 @@
                 //Returning to original position
                 if (parked_near_wipe)
                 {
-                	unpark_from_wipe();
+                	queued_time += unpark_from_wipe();
                 	//mechanics.set_current_to_destination();
                 }
                 else
                 {
-    				mechanics.do_blocking_move_to(mechanics.destination[X_AXIS], mechanics.destination[Y_AXIS], mechanics.current_position[Z_AXIS]);
-    				mechanics.do_blocking_move_to_z(mechanics.destination[Z_AXIS], mechanics.max_feedrate_mm_s[Z_AXIS]);
+    				queued_time += mechanics.queue_move_to(mechanics.destination[X_AXIS], mechanics.destination[Y_AXIS], mechanics.current_position[Z_AXIS]);
+    				queued_time += mechanics.queue_move_to(mechanics.destination[X_AXIS], mechanics.destination[Y_AXIS], mechanics.destination[Z_AXIS], mechanics.max_feedrate_mm_s[Z_AXIS]);
                 }
 
 
@@ -248,10 +272,20 @@
 
         } // (tmp_extruder != active_extruder)
 
+        // The EG6 switch moves stay in the planner, the next moves are queued behind them.
+        // The only stop is the new position of the planner, set before the moves.
+        #if DISABLED(EG6_EXTRUDER) || ENABLED(EXT_SOLENOID)
+          stepper.synchronize();
+        #endif
 
-
-
-        stepper.synchronize();
+        // Time of the change, with the switch moves still in the planner
+        if (changing) {
+          const millis_l change_ms = millis() - change_start_ms + (millis_l)(queued_time * 1000.0f);
+          print_job_counter.toolChange(active_extruder, change_ms);
+          #if HAS_SWITCH_TEST
+            switchtest.tool_changed(change_ms);
+          #endif
+        }
 
         #if ENABLED(EXT_SOLENOID)
           disable_all_solenoids();
@@ -378,50 +412,189 @@ int8_t Tools::plastic_driver_of_extruder(uint8_t e) {
 
 void Tools::cut_fiber() {
 	stepper.synchronize();
+	#if HOTENDS > 1
+	  const millis_l cut_start_ms = millis();
+	#endif
     MOVE_SERVO(cut_servo_id, cut_active_angle);
     MOVE_SERVO(cut_servo_id, cut_neutral_angle);
-    fiber_is_cut = true;
+    fiber_cut_done();
+	#if HOTENDS > 1
+	  print_job_counter.toolCut(millis() - cut_start_ms);
+	#endif
+}
+
+/**
+ * Log the fiber transitions seen by the stepper ISR
+ */
+void Tools::fiber_spin() {
+	if (fiber_feed_event) {
+	  fiber_feed_event = false;
+	  if (printer.debugInfo()) SERIAL_LM(ECHO, "Fiber feed start");
+	}
+	if (fiber_cut_event) {
+	  fiber_cut_event = false;
+	  if (printer.debugInfo()) SERIAL_LMV(ECHO, "Fiber cut, fed ms:", (uint32_t)fiber_fed_time);
+	}
+	#if HAS_SERVOS
+	  if (cut_opened_event) {
+	    cut_opened_event = false;
+	    #if HOTENDS > 1
+	      print_job_counter.toolCut(cut_hold_time);
+	    #endif
+	  }
+	  #if ENABLED(DEACTIVATE_SERVOS_AFTER_MOVE)
+	    // As MOVE_SERVO, stop the servo once the blade had the time to open
+	    if (cut_servo_attached && !cuts_queued && ELAPSED(millis(), cut_open_ms + SERVO_DEACTIVATION_DELAY)) {
+	      cut_servo_attached = false;
+	      servo[cut_servo_id].detach();
+	    }
+	  #endif
+	#endif
+}
+
+/**
+ * Cut at the end of the last queued move, without waiting for it.
+ * The stepper ISR closes the blade, holds the next move for the
+ * dwell and opens the blade while the next move runs.
+ */
+void Tools::queue_fiber_cut() {
+	#if HAS_SERVOS
+	  if (cut_servo_id < NUM_SERVOS && servo[cut_servo_id].available() && planner.has_blocks_queued()) {
+	    // Pulsing before the ISR moves it, counted before the block can end
+	    servo[cut_servo_id].attach(0);
+	    cut_servo_attached = true;
+	    bool queued;
+	    CRITICAL_SECTION_START
+	      if ((queued = planner.set_fiber_cut())) cuts_queued++;
+	    CRITICAL_SECTION_END
+	    // The hold time is logged by fiber_spin() when the blade is open
+	    if (queued) return;
+	  }
+	#endif
+	// Nothing to wait for, cut now
+	cut_fiber();
 }
 
 #if ENABLED(EG6_EXTRUDER)
 
-void Tools::park_to_wipe() {
+float Tools::park_to_wipe() {
 
-	wipepark_return_position[X_AXIS] = mechanics.current_position[X_AXIS];
-	wipepark_return_position[Y_AXIS] = mechanics.current_position[Y_AXIS];
-	wipepark_return_position[Z_AXIS] = mechanics.current_position[Z_AXIS];
+	// The planner end position, the return does not need the moves before done
+	if (!parked_near_wipe) {
+		wipepark_return_position[X_AXIS] = mechanics.current_position[X_AXIS];
+		wipepark_return_position[Y_AXIS] = mechanics.current_position[Y_AXIS];
+		wipepark_return_position[Z_AXIS] = mechanics.current_position[Z_AXIS];
+	}
 
-	stepper.synchronize();
-	float x_target, y_target;
+	float time = 0.0;
 	uint8_t next_extruder = 0;
 	if (active_extruder==0) next_extruder = 1;
 	if (hotend_switch_path[next_extruder][0].Speed>0)
 	{
-		mechanics.do_blocking_move_to_xy(
+		// Queued, the commands after it (heating) start while it runs
+		time = mechanics.queue_move_to(
 				Mechanics::homeCS2toolCS(active_extruder, hotend_switch_path[next_extruder][0].X, AxisEnum::X_AXIS),
 				Mechanics::homeCS2toolCS(active_extruder, hotend_switch_path[next_extruder][0].Y, AxisEnum::Y_AXIS),
+				mechanics.current_position[Z_AXIS],
 				hotend_switch_path[next_extruder][0].Speed);
 		parked_near_wipe = true;
+		// Planner estimate of the park moves, they may still be queued
+		print_job_counter.toolPark(time * 1000);
 	}
+	return time;
 }
 
-void Tools::unpark_from_wipe() {
+void Tools::park_heat_return(const uint8_t tool, const int16_t temp, const bool back) {
+
+	park_to_wipe();
+
+	// Heat while the park runs
+	heaters[tool].setTarget(temp);
+	#if ENABLED(NEXTION_HMI)
+		if (heaters[tool].isHeating()) NextionHMI::RaiseEvent(HMIevent::HEATING_STARTED_EXTRUDER, tool);
+	#endif
+
+	// Wait for the last of the two, the park moves run in the heating wait
+	thermalManager.wait_heater(&heaters[tool], true);
+	stepper.synchronize();
+
+	#if ENABLED(NEXTION_HMI)
+		if (printer.isWaitForHeatUp()) NextionHMI::RaiseEvent(HMIevent::HEATING_FINISHED);
+	#endif
+
+	// The return is known since the park, queue it with nothing more to wait
+	if (back) unpark_from_wipe();
+}
+
+float Tools::unpark_from_wipe() {
+	float time = 0.0;
 	if (parked_near_wipe)
 	{
-		stepper.synchronize();
-		float x_target, y_target;
 		uint8_t next_extruder = 0;
 		if (active_extruder==0) next_extruder = 1;
 		if (hotend_switch_path[next_extruder][0].Speed>0)
 		{
-			mechanics.do_blocking_move_to_xy(
+			// Left in the planner, after the switch path of a tool change
+			time += mechanics.queue_move_to(
 					wipepark_return_position[X_AXIS],
 					wipepark_return_position[Y_AXIS],
+					mechanics.current_position[Z_AXIS],
 					hotend_switch_path[next_extruder][0].Speed);
-			mechanics.do_blocking_move_to_z(wipepark_return_position[Z_AXIS], mechanics.max_feedrate_mm_s[Z_AXIS]);
+			time += mechanics.queue_move_to(
+					wipepark_return_position[X_AXIS],
+					wipepark_return_position[Y_AXIS],
+					wipepark_return_position[Z_AXIS],
+					mechanics.max_feedrate_mm_s[Z_AXIS]);
 			parked_near_wipe = false;
 		}
 	}
+	return time;
+}
+
+void Tools::factory_switch_path(const uint8_t h) {
+	static const ToolSwitchPos path_t0[] PROGMEM = CHANGE_T0;
+	#if HOTENDS > 1
+		static const ToolSwitchPos path_t1[] PROGMEM = CHANGE_T1;
+	#endif
+	for (uint8_t i = 0; i < CHANGE_MOVES; i++)
+	{
+		#if HOTENDS > 1
+			if (h == 1) { hotend_switch_path[h][i] = path_t1[i]; continue; }
+		#endif
+		hotend_switch_path[h][i] = path_t0[i];
+	}
+}
+
+bool Tools::switch_move_valid(const ToolSwitchPos &move) {
+	// Speed 0 is a move not used, NaN from a blank EEPROM fails every test
+	if (move.Speed == 0) return true;
+	if (!(move.Speed > 0 && move.Speed <= mechanics.max_feedrate_mm_s[X_AXIS])) return false;
+
+	static const float min_pos[] = CHANGE_MOVES_MIN_POS,
+	                   max_pos[] = CHANGE_MOVES_MAX_POS;
+	const float x = move.SwitchMove ? move.X + switch_offset_x : move.X,
+	            y = move.SwitchMove ? move.Y + switch_offset_y : move.Y;
+	return WITHIN(x, min_pos[X_AXIS], max_pos[X_AXIS]) && WITHIN(y, min_pos[Y_AXIS], max_pos[Y_AXIS]);
+}
+
+bool Tools::switch_path_valid(const uint8_t h) {
+	for (uint8_t i = 0; i < CHANGE_MOVES; i++)
+		if (!switch_move_valid(hotend_switch_path[h][i])) return false;
+	return true;
+}
+
+bool Tools::check_switch_path() {
+	bool valid = true;
+	LOOP_HOTEND()
+	{
+		if (!switch_path_valid(h))
+		{
+			SERIAL_LMV(ER, "Tool switch path out of limits, factory path for T", (int)h);
+			factory_switch_path(h);
+			valid = false;
+		}
+	}
+	return valid;
 }
 
 #endif
@@ -72,10 +72,24 @@
       static uint8_t   cut_servo_id;
       static uint8_t   cut_active_angle;
       static uint8_t   cut_neutral_angle;
+      static uint16_t  cut_dwell;
 
       static bool fiber_is_cut;
       static bool printing_with_fiber;
 
+      static volatile bool  fiber_feed_event,   // Set by the stepper ISR, logged by fiber_spin()
+                            fiber_cut_event;
+      static millis_l       fiber_feed_ms,      // Start of the last fiber feed
+                            fiber_fed_time;     // ms from the feed start to the cut
+
+      #if HAS_SERVOS
+        static volatile bool      cut_opened_event; // Set by the stepper ISR, logged by fiber_spin()
+        static volatile uint8_t   cuts_queued;      // Cuts left to the stepper ISR, blade not open yet
+        static volatile millis_l  cut_hold_time,    // ms the stepper held the moves for the last cut
+                                  cut_open_ms;
+        static bool               cut_servo_attached;
+      #endif
+
 	  #if ENABLED(EG6_EXTRUDER)
         static ToolSwitchPos hotend_switch_path[HOTENDS][CHANGE_MOVES];
         static float wipepark_return_position[XYZ];
@@ -99,6 +113,33 @@
     public: /** Public Function */
 
       static void cut_fiber();
+      static void queue_fiber_cut();
+      static void fiber_spin();
+
+      // Called by the stepper ISR for the first fiber block after a cut
+      FORCE_INLINE static void fiber_feed_start() {
+        if (fiber_is_cut) {
+          fiber_is_cut = false;
+          fiber_feed_ms = millis();
+          fiber_feed_event = true;
+        }
+      }
+
+      #if HAS_SERVOS
+        // Called by the stepper ISR when the blade of a queued cut is open
+        FORCE_INLINE static void fiber_cut_opened(const millis_l hold) {
+          cut_hold_time = hold;
+          cut_open_ms = millis();
+          if (cuts_queued) cuts_queued--;
+          cut_opened_event = true;
+        }
+      #endif
+
+      FORCE_INLINE static void fiber_cut_done() {
+        fiber_fed_time = fiber_is_cut ? 0 : millis() - fiber_feed_ms;
+        fiber_is_cut = true;
+        fiber_cut_event = true;
+      }
 
       static void change(const uint8_t tmp_extruder, const float fr_mm_s=0.0, bool no_move=false, bool force=false, bool clean=false);
 
@@ -115,8 +156,13 @@
       }
 
 	#if ENABLED(EG6_EXTRUDER)
-      static void park_to_wipe();
-      static void unpark_from_wipe();
+      static float park_to_wipe();      // Return the seconds of the queued move
+      static float unpark_from_wipe();  // Return the seconds of the queued moves
+      static void park_heat_return(const uint8_t tool, const int16_t temp, const bool back);
+      static void factory_switch_path(const uint8_t h);
+      static bool switch_move_valid(const ToolSwitchPos &move);
+      static bool switch_path_valid(const uint8_t h);
+      static bool check_switch_path();  // Factory path for the tools with a move out of limits
 	#endif
 
       #if ENABLED(VOLUMETRIC_EXTRUSION)
@@ -24,83 +24,85 @@
 
 #if HAS_SD_RESTART
 
+  static_assert(sizeof(restart_job_t) + sizeof(restart_state_t) <= RESTART_BLOCK_SIZE, "restart_job_t and restart_state_t don't fit in a journal block.");
+
   Restart restart;
 
-  restart_job_t Restart::job_info;
-  restart_phase Restart::job_phase = RESTART_IDLE;
+  bool            Restart::enabled      = true;
+
+  restart_job_t   Restart::job_info;
+  restart_state_t Restart::state_info;
+  restart_phase   Restart::job_phase    = RESTART_IDLE;
+
+  char      Restart::buffer_ring[APPEND_CMD_COUNT][MAX_CMD_SIZE];
+  uint8_t   Restart::count              = 0;
 
-  char    Restart::buffer_ring[BUFSIZE + APPEND_CMD_COUNT][MAX_CMD_SIZE];
-  uint8_t Restart::count  = 0;
+  uint32_t  Restart::cmd_sdpos          = 0;
+
+  uint8_t   Restart::journal[RESTART_BLOCK_SIZE];
+  uint32_t  Restart::journal_first      = 0,
+            Restart::journal_block      = 0,
+            Restart::last_seq           = 0;
+  uint8_t   Restart::journal_slot       = RESTART_STATE_COUNT;
+  bool      Restart::job_started        = false;
+  float     Restart::saved_z            = 0.0;
 
   void Restart::do_print_job() {
 
-    memset(&job_info, 0, sizeof(job_info));
     ZERO(buffer_ring);
+    count = 0;
 
     if (!card.cardOK) card.mount();
 
     if (card.cardOK) {
 
       #if ENABLED(DEBUG_RESTART)
-        SERIAL_EMV("Init restart infomation. Size: ", (int)sizeof(job_info));
+        SERIAL_MV("Init restart infomation. Job size: ", (int)sizeof(restart_job_t));
+        SERIAL_EMV(" State size: ", (int)sizeof(restart_state_t));
       #endif
 
-      if (card.exist_restart_file()) {
-        card.open_restart_file(true);
-        card.read_restart_data();
-        card.close_restart_file();
+      if (!open_journal()) return;
 
-        if ((job_info.valid_head) && job_info.valid_head == job_info.valid_foot) {
-
-          uint8_t index = 0;
-          char str_X[10], str_Y[10], str_Z[10], str_E[10];
-
-          ZERO(str_X);
-          ZERO(str_Y);
-          ZERO(str_Z);
-          ZERO(str_E);
-
-          dtostrf(job_info.current_position[X_AXIS], 1, 3, str_X);
-          dtostrf(job_info.current_position[Y_AXIS], 1, 3, str_Y);
-          dtostrf(job_info.current_position[Z_AXIS], 1, 3, str_Z);
-          dtostrf(job_info.current_position[E_AXIS], 1, 3, str_E);
-
-          #if Z_HOME_DIR > 0
-            sprintf_P(buffer_ring[index++], PSTR("G92 E%s"), str_E);
-            sprintf_P(buffer_ring[index++], PSTR("G0 X%s Y%s Z%s"), str_X, str_Y, str_Z);
-            strcpy(buffer_ring[index++], PSTR("M117 Printing..."));
-          #else
-            sprintf_P(buffer_ring[index++], PSTR("G92 Z%s E%s"), str_Z, str_E);
-            sprintf_P(buffer_ring[index++], PSTR("G0 X%s Y%s Z%s"), str_X, str_Y, str_Z);
-            strcpy(buffer_ring[index++], PSTR("M117 Printing..."));
-          #endif
+      #if ENABLED(DEBUG_RESTART)
+        debug_info();
+      #endif
 
-          uint8_t read = job_info.buffer_index_r;
-          while (job_info.buffer_lenght) {
-            strcpy(buffer_ring[index++], job_info.buffer_ring[read]);
-            job_info.buffer_lenght--;
-            read = (read + 1) % BUFSIZE;
-          }
+      // Nothing to resume if the last job ended or was never saved
+      if (!state_info.seq || state_info.job_ended) return;
+
+      uint8_t index = 0;
+      char str_X[10], str_Y[10], str_Z[10], str_E[10];
+
+      ZERO(str_X);
+      ZERO(str_Y);
+      ZERO(str_Z);
+      ZERO(str_E);
+
+      dtostrf(state_info.current_position[X_AXIS], 1, 3, str_X);
+      dtostrf(state_info.current_position[Y_AXIS], 1, 3, str_Y);
+      dtostrf(state_info.current_position[Z_AXIS], 1, 3, str_Z);
+      dtostrf(state_info.current_position[E_AXIS], 1, 3, str_E);
+
+      #if Z_HOME_DIR > 0
+        sprintf_P(buffer_ring[index++], PSTR("G92 E%s"), str_E);
+        sprintf_P(buffer_ring[index++], PSTR("G0 X%s Y%s Z%s"), str_X, str_Y, str_Z);
+        strcpy(buffer_ring[index++], PSTR("M117 Printing..."));
+      #else
+        sprintf_P(buffer_ring[index++], PSTR("G92 Z%s E%s"), str_Z, str_E);
+        sprintf_P(buffer_ring[index++], PSTR("G0 X%s Y%s Z%s"), str_X, str_Y, str_Z);
+        strcpy(buffer_ring[index++], PSTR("M117 Printing..."));
+      #endif
 
-          count = index;
+      count = index;
 
-          #if ENABLED(DEBUG_RESTART)
-            debug_info(true);
-          #endif
+      // The saved position is the start of the command that was in progress,
+      // the commands after it are read again from the file.
+      card.selectFile(job_info.fileName);
+      card.setIndex(state_info.sdpos);
 
-          card.selectFile(job_info.fileName);
-          card.setIndex(job_info.sdpos);
+      // Auto Restart
+      if (state_info.auto_restart) start_job();
 
-          // Auto Restart
-          if (job_info.auto_restart) start_job();
-
-        }
-        else {
-          if ((job_info.valid_head != 0) && (job_info.valid_head != job_info.valid_foot))
-            LCD_MESSAGEPGM("RECOVERY INVALID DATA.");
-          memset(&job_info, 0, sizeof(job_info));
-        }
-      }
     }
   }
 
@@ -116,7 +118,7 @@
     #endif
 
 	#if EXTRUDERS > 1
-	  tools.change(job_info.active_extruder, 0, true);
+	  tools.change(state_info.active_extruder, 0, true);
 	#endif
 
     // Set leveling
@@ -130,54 +132,48 @@
     // Set temperature
     #if HEATER_COUNT > 0
       LOOP_HEATER() {
-        heaters[h].target_temperature = job_info.target_temperature[h];
+        heaters[h].target_temperature = state_info.target_temperature[h];
         thermalManager.wait_heater(&heaters[h], true);
       }
     #endif
 
     // Set fan
     #if FAN_COUNT > 0
-      LOOP_FAN() fans[f].Speed = job_info.fan_speed[f];
+      LOOP_FAN() fans[f].Speed = state_info.fan_speed[f];
     #endif
 
+    // Back to the saved position before the file goes on
+    for (uint8_t i = 0; i < count; i++) commands.enqueue_one_now(buffer_ring[i]);
+
     job_phase = RESTART_YES;
 
     card.startFileprint();
-    print_job_counter.resume(job_info.print_job_counter_elapsed);
+    print_job_counter.resume(state_info.print_job_counter_elapsed);
 
   }
 
-  void Restart::save_data(const bool force_save/*=false*/) {
+  /**
+   * Append a state record to the journal. Called for the moves with E or Z:
+   * every SD_RESTART_FILE_SAVE_TIME seconds, on every layer change and when forced.
+   */
+  void Restart::save_job(const bool force_save/*=false*/) {
 
     static watch_t save_restart_watch((SD_RESTART_FILE_SAVE_TIME) * 1000UL);
 
-    if (save_restart_watch.elapsed() || force_save) {
+    if (job_started && !force_save && !save_restart_watch.elapsed() && mechanics.current_position[Z_AXIS] == saved_z) return;
 
-      job_info.valid_head = random(1, 256);
-      job_info.valid_foot = job_info.valid_head;
+    // The first save of a job writes the job data in a new block
+    if (!job_started) {
+      memset(&job_info, 0, sizeof(job_info));
+      job_info.job_id = last_seq + 1;
 
-      // Mechanics state
-      COPY_ARRAY(job_info.current_position, mechanics.current_position);
-
-      #if HEATER_COUNT > 0
-        LOOP_HEATER()
-          job_info.target_temperature[h] = heaters[h].target_temperature;
-      #endif
-
-      #if FAN_COUNT > 0
-        LOOP_FAN()
-          job_info.fan_speed[f] = fans[f].Speed;
-      #endif
-
-      // Extruders
-      #if EXTRUDERS > 1
-        job_info.active_extruder = tools.active_extruder;
-      #endif
+      // SD file
+      card.getAbsFilename(job_info.fileName);
 
       // Leveling
       #if HAS_LEVELING
         job_info.leveling = bedlevel.leveling_active;
-        job_info.z_fade_height = 
+        job_info.z_fade_height =
           #if ENABLED(ENABLE_LEVELING_FADE_HEIGHT)
             bedlevel.z_fade_height;
           #else
@@ -185,69 +181,191 @@
           #endif
       #endif
 
-      // Commands in the queue
-      job_info.buffer_index_r = commands.buffer_index_r;
-      job_info.buffer_lenght = commands.buffer_lenght;
-      COPY_ARRAY(job_info.buffer_ring, commands.buffer_ring);
+      journal_slot = RESTART_STATE_COUNT;
+      job_started = true;
+    }
+
+    restart_state_t state;
+    memset(&state, 0, sizeof(state));
 
-      // Elapsed print job time
-      job_info.print_job_counter_elapsed = print_job_counter.duration() * 1000UL;
+    // SD position of the command in progress, the queue holds the commands read after it
+    state.sdpos = commands.buffer_ring.isEmpty() ? card.getIndex() : commands.buffer_ring.peek().sdpos;
 
-      // SD file e position
-      if (!job_info.just_restart) {
-        card.getAbsFilename(job_info.fileName);
-        job_info.just_restart = true;
-      }
-      job_info.sdpos = card.getIndex();
+    // Mechanics state
+    COPY_ARRAY(state.current_position, mechanics.current_position);
 
-      job_info.auto_restart = !force_save;
+    #if HEATER_COUNT > 0
+      LOOP_HEATER()
+        state.target_temperature[h] = heaters[h].target_temperature;
+    #endif
 
-      #if ENABLED(DEBUG_RESTART)
-        SERIAL_EM("Saving job_info");
-        debug_info(false);
-      #endif
+    #if FAN_COUNT > 0
+      LOOP_FAN()
+        state.fan_speed[f] = fans[f].Speed;
+    #endif
+
+    // Extruders
+    #if EXTRUDERS > 1
+      state.active_extruder = tools.active_extruder;
+    #endif
+
+    // Elapsed print job time
+    state.print_job_counter_elapsed = print_job_counter.duration();
+
+    state.auto_restart = !force_save;
 
-      card.open_restart_file(false);
-      (void)card.save_restart_data();
+    if (append(state)) {
+      saved_z = mechanics.current_position[Z_AXIS];
       save_restart_watch.start();
     }
   }
 
-  #if ENABLED(DEBUG_RESTART)
+  /**
+   * Close the job in the journal, so it is not offered for restart
+   */
+  void Restart::end_job() {
+    job_started = false;
+    count = 0;
+
+    if (!state_info.seq || state_info.job_ended) return;
 
-    void Restart::debug_info(const bool restart) {
+    restart_state_t state;
+    memset(&state, 0, sizeof(state));
+    state.job_ended = true;
+    (void)append(state);
+  }
+
+  /**
+   * Find restart.bin and the last valid record in it
+   */
+  bool Restart::open_journal() {
+
+    if (journal_first) return true;
+
+    last_seq = 0;
+    journal_block = 0;
+    journal_slot = RESTART_STATE_COUNT;
+    job_started = false;
+    memset(&job_info, 0, sizeof(job_info));
+    memset(&state_info, 0, sizeof(state_info));
+
+    bool created;
+    uint32_t first_block;
+    if (!card.open_restart_journal(first_block, created)) return false;
+
+    Sd2Card &sd = card.getSd2Card();
+
+    // A new file may hold old data: clear it
+    if (created) {
+      ZERO(journal);
+      for (uint32_t b = 0; b < SD_RESTART_JOURNAL_BLOCKS; b++)
+        if (!sd.writeBlock(first_block + b, journal)) return false;
+    }
+    else {
+      restart_job_t job;
+      restart_state_t state;
+      for (uint32_t b = 0; b < SD_RESTART_JOURNAL_BLOCKS; b++) {
+        if (!sd.readBlock(first_block + b, journal)) return false;
+        memcpy(&job, journal, sizeof(job));
+        if (job.crc != crc16(&job, offsetof(restart_job_t, crc))) continue;
+        for (uint8_t s = 0; s < RESTART_STATE_COUNT; s++) {
+          memcpy(&state, journal + sizeof(restart_job_t) + s * sizeof(restart_state_t), sizeof(state));
+          if (state.seq <= last_seq || state.crc != crc16(&state, offsetof(restart_state_t, crc))) continue;
+          last_seq = state.seq;
+          journal_block = b;
+          journal_slot = s + 1;
+          job_info = job;
+          state_info = state;
+        }
+      }
+      // Keep on appending to the block of the last record
+      if (last_seq && !sd.readBlock(first_block + journal_block, journal)) return false;
+    }
+
+    journal_first = first_block;
+    return true;
+  }
 
-      SERIAL_MV("Valid Head:", (int)job_info.valid_head);
-      SERIAL_EMV(" Valid Foot:", (int)job_info.valid_foot);
-      if (job_info.valid_head) {
-        if (job_info.valid_head == job_info.valid_foot) {
+  bool Restart::append(restart_state_t &state) {
+
+    if (!card.cardOK || !open_journal()) return false;
+
+    // Next block: the job data first, then the records
+    if (journal_slot >= RESTART_STATE_COUNT) {
+      journal_block = (journal_block + 1) % (SD_RESTART_JOURNAL_BLOCKS);
+      journal_slot = 0;
+      ZERO(journal);
+      job_info.crc = crc16(&job_info, offsetof(restart_job_t, crc));
+      memcpy(journal, &job_info, sizeof(job_info));
+    }
+
+    state.seq = last_seq + 1;
+    state.crc = crc16(&state, offsetof(restart_state_t, crc));
+    memcpy(journal + sizeof(restart_job_t) + journal_slot * sizeof(restart_state_t), &state, sizeof(state));
+
+    // One block write, no FAT or directory update
+    if (!card.getSd2Card().writeBlock(journal_first + journal_block, journal)) {
+      close_journal();
+      return false;
+    }
+
+    last_seq = state.seq;
+    journal_slot++;
+    state_info = state;
+    return true;
+  }
+
+  // CRC-16/CCITT, polynomial 0x1021
+  uint16_t Restart::crc16(const void* data, const size_t size) {
+    const uint8_t* p = (const uint8_t*)data;
+    uint16_t crc = 0xFFFF;
+    for (size_t i = 0; i < size; i++) {
+      crc = (uint8_t)(crc >> 8) | (crc << 8);
+      crc ^= p[i];
+      crc ^= (uint8_t)(crc & 0xFF) >> 4;
+      crc ^= crc << 12;
+      crc ^= (crc & 0xFF) << 5;
+    }
+    return crc;
+  }
+
+  #if ENABLED(DEBUG_RESTART)
+
+    void Restart::debug_info() {
+
+      SERIAL_MV("Last save:", last_seq);
+      SERIAL_MV(" Block:", journal_block);
+      SERIAL_EMV(" Slot:", (int)journal_slot);
+      if (state_info.seq) {
+        SERIAL_EMV("Job:", job_info.job_id);
+        SERIAL_EMT("Filename: ", job_info.fileName);
+        #if HAS_LEVELING
+          SERIAL_EMV("leveling: ", int(job_info.leveling));
+          SERIAL_EMV(" z_fade_height: ", int(job_info.z_fade_height));
+        #endif
+        if (state_info.job_ended)
+          SERIAL_EM("Job ended");
+        else {
           SERIAL_MSG("current_position");
-          LOOP_XYZE(i) SERIAL_MV(": ", job_info.current_position[i]);
-          SERIAL_EOL();
-          SERIAL_MSG("target_temperature");
-          LOOP_HEATER() SERIAL_MV(": ", job_info.target_temperature[h]);
+          LOOP_XYZE(i) SERIAL_MV(": ", state_info.current_position[i]);
           SERIAL_EOL();
-          SERIAL_MSG("fanSpeeds");
-          LOOP_FAN() SERIAL_MV(": ", job_info.fan_speed[f]);
-          SERIAL_EOL();
-          #if HAS_LEVELING
-            SERIAL_EMV("leveling: ", int(job_info.leveling));
-            SERIAL_EMV(" z_fade_height: ", int(job_info.z_fade_height));
+          #if HEATER_COUNT > 0
+            SERIAL_MSG("target_temperature");
+            LOOP_HEATER() SERIAL_MV(": ", state_info.target_temperature[h]);
+            SERIAL_EOL();
+          #endif
+          #if FAN_COUNT > 0
+            SERIAL_MSG("fanSpeeds");
+            LOOP_FAN() SERIAL_MV(": ", (int)state_info.fan_speed[f]);
+            SERIAL_EOL();
           #endif
-          SERIAL_EMV("buffer_index_r: ", job_info.buffer_index_r);
-          SERIAL_EMV("buffer_lenght: ", job_info.buffer_lenght);
-          if (restart)
-            for (uint8_t i = 0; i < count; i++) SERIAL_EMV("> ", buffer_ring[i]);
-          else
-            for (uint8_t i = 0; i < job_info.buffer_lenght; i++) SERIAL_EMV("> ", job_info.buffer_ring[i]);
-          SERIAL_EMT("Filename: ", job_info.fileName);
-          SERIAL_EMV("sdpos: ", job_info.sdpos);
-          SERIAL_EMV("print_job_counter_elapsed: ", job_info.print_job_counter_elapsed);
-          SERIAL_EMV("auto_restart: ", int(job_info.auto_restart));
+          SERIAL_EMV("sdpos: ", state_info.sdpos);
+          SERIAL_EMV("print_job_counter_elapsed: ", state_info.print_job_counter_elapsed);
+          SERIAL_EMV("auto_restart: ", int(state_info.auto_restart));
         }
-        else
-          SERIAL_EM("INVALID DATA");
       }
+      else
+        SERIAL_EM("NO DATA");
     }
 
   #endif
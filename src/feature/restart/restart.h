@@ -29,44 +29,64 @@
 
   #define APPEND_CMD_COUNT 3
 
+  /**
+   * restart.bin is a journal of SD_RESTART_JOURNAL_BLOCKS blocks, allocated
+   * once and then written with raw single block writes. Every block starts
+   * with the job data and is filled with state records, each save appends
+   * one record. The record with the highest sequence number is the last save.
+   */
+
+  // Job data, repeated at the start of every journal block
   typedef struct {
-    uint8_t valid_head;
+    uint32_t job_id;                        // Sequence number of the first save of the job
 
-    // SD file e position
+    // SD file
     char fileName[LONG_FILENAME_LENGTH];
+
+    // Leveling
+    #if HAS_LEVELING
+      bool leveling;
+      float z_fade_height;
+    #endif
+
+    uint16_t crc;
+  } restart_job_t;
+
+  // State record, one for every save
+  typedef struct {
+    uint32_t seq;                           // Sequence number, 0 for an unused slot
+
+    // SD position of the command in progress
     uint32_t sdpos;
 
     // Mechanics state
     float current_position[XYZE];
-    int16_t target_temperature[HEATER_COUNT];
-    uint8_t fan_speed[FAN_COUNT];
 
-    // Extruders
-    #if EXTRUDERS > 1
-      uint8_t active_extruder;
+    #if HEATER_COUNT > 0
+      int16_t target_temperature[HEATER_COUNT];
     #endif
 
-    // Leveling
-    #if HAS_LEVELING
-      bool leveling;
-      float z_fade_height;
+    #if FAN_COUNT > 0
+      uint8_t fan_speed[FAN_COUNT];
     #endif
 
-    // Command buffer
-    uint8_t buffer_index_r;
-    uint8_t buffer_lenght;
-    char buffer_ring[BUFSIZE][MAX_CMD_SIZE];
+    // Extruders
+    #if EXTRUDERS > 1
+      uint8_t active_extruder;
+    #endif
 
-    // Job elapsed time
-    millis_t print_job_counter_elapsed;
+    // Job elapsed time in seconds
+    millis_l print_job_counter_elapsed;
 
     // Utility
     bool auto_restart;
-    bool just_restart;
+    bool job_ended;
 
-    uint8_t valid_foot;
+    uint16_t crc;
+  } restart_state_t;
 
-  } restart_job_t;
+  #define RESTART_BLOCK_SIZE  512
+  #define RESTART_STATE_COUNT ((RESTART_BLOCK_SIZE - sizeof(restart_job_t)) / sizeof(restart_state_t))
 
   enum restart_phase : unsigned char {
     RESTART_IDLE,
@@ -82,24 +102,45 @@
 
     public: /** Public Parameters */
 
-      static restart_job_t  job_info;
-      static restart_phase  job_phase;
+      static bool             enabled;
 
-      static char buffer_ring[BUFSIZE + APPEND_CMD_COUNT][MAX_CMD_SIZE];
+      static restart_job_t    job_info;
+      static restart_state_t  state_info;
+      static restart_phase    job_phase;
+
+      static char buffer_ring[APPEND_CMD_COUNT][MAX_CMD_SIZE];
       static uint8_t count;
 
+      static uint32_t cmd_sdpos;            // SD position of the next command read from file
+
     private: /** Private Parameters */
 
+      static uint8_t  journal[RESTART_BLOCK_SIZE];
+      static uint32_t journal_first,        // First SD block of restart.bin, 0 if not open
+                      journal_block,        // Block in use, from 0 to SD_RESTART_JOURNAL_BLOCKS - 1
+                      last_seq;
+      static uint8_t  journal_slot;         // Next free state slot in the block in use
+      static bool     job_started;
+      static float    saved_z;
+
     public: /** Public Function */
 
+      // Forget the journal position, the card may have been changed
+      FORCE_INLINE static void close_journal() { journal_first = 0; }
+
       static void do_print_job();
       static void start_job();
-      static void save_data(const bool force_save=false);
+      static void save_job(const bool force_save=false);
+      static void end_job();
 
     private: /** Private Function */
 
+      static bool open_journal();
+      static bool append(restart_state_t &state);
+      static uint16_t crc16(const void* data, const size_t size);
+
       #if ENABLED(DEBUG_RESTART)
-        static void debug_info(const bool restart);
+        static void debug_info();
       #endif
 
   };
@@ -485,6 +485,8 @@
 
   bool Servo::attached() { return servo_info[this->servoIndex].Pin.isActive; }
 
+  bool Servo::available() { return this->servoIndex < MAX_SERVOS; }
+
   void Servo::move(int value) {
     if (this->attach(0) >= 0) {
       this->write(value);
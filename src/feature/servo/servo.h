@@ -128,6 +128,7 @@
       int read();                         // returns current pulse width as an angle between 0 and 180 degrees
       int readMicroseconds();             // returns current pulse width in microseconds for this servo (was read_us() in first release)
       bool attached();                    // return true if this servo is attached, otherwise false
+      bool available();                   // return true if this servo has a channel, without attaching it
 
     private:
 
@@ -95,6 +95,10 @@ class Circular_Queue {
       return this->buffer.queue[index];
     }
 
+    T& item(const uint8_t index) {
+      return this->buffer.queue[index];
+    }
+
     uint8_t count() {
       return this->buffer.count;
     }
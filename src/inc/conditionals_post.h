@@ -398,6 +398,9 @@
 #define WATCH_THE_CHAMBER               (HAS_THERMALLY_PROTECTED_CHAMBER  && WATCH_CHAMBER_TEMP_PERIOD  > 0)
 #define WATCH_THE_COOLER                (HAS_THERMALLY_PROTECTED_COOLER   && WATCH_COOLER_TEMP_PERIOD   > 0)
 #define WATCH_THE_HEATER                (WATCH_THE_HOTEND || WATCH_THE_BED || WATCH_THE_CHAMBER || WATCH_THE_COOLER)
+#define HAS_THERMAL_LOG                 (ENABLED(THERMAL_LOG) && HEATER_COUNT > 0)
+#define HAS_HOTEND_STANDBY              (ENABLED(HOTEND_STANDBY) && HOTENDS > 1 && HAS_TEMP_HOTEND)
+#define HAS_SWITCH_TEST                 (ENABLED(SWITCH_TEST) && HOTENDS > 1 && EXTRUDERS > 1)
 
 // Other fans
 #define HAS_FAN0            (PIN_EXISTS(FAN0))
@@ -553,6 +556,10 @@
   #define HAS_FOLDER_SORTING  (FOLDER_SORTING || ENABLED(SDSORT_GCODE))
 #endif
 #define HAS_SD_RESTART        (ENABLED(SDSUPPORT) && ENABLED(SD_RESTART_FILE))
+#define HAS_SD_DIR_CACHE      (ENABLED(SDSUPPORT) && ENABLED(SD_DIR_CACHE))
+#define HAS_FILE_TRANSFER     (ENABLED(SDSUPPORT) && ENABLED(BINARY_FILE_TRANSFER))
+#define HAS_SD_PACKED_GCODE   (ENABLED(SDSUPPORT) && ENABLED(SD_PACKED_GCODE))
+#define HAS_SD_IO_STATS       (ENABLED(SDSUPPORT) && ENABLED(SD_IO_STATS))
 
 // Extruder Encoder
 #define HAS_EXT_ENCODER       (ENABLED(EXTRUDER_ENCODER_CONTROL) && (HAS_E0_ENC || HAS_E1_ENC || HAS_E2_ENC || HAS_E3_ENC || HAS_E4_ENC || HAS_E5_ENC))
@@ -956,6 +963,7 @@
 #define HEATER_USES_AD595     (ENABLED(HEATER_0_USES_AD595) || ENABLED(HEATER_1_USES_AD595) || ENABLED(HEATER_2_USES_AD595) || ENABLED(HEATER_3_USES_AD595) || ENABLED(BED_USES_AD595) || ENABLED(CHAMBER_USES_AD595) || ENABLED(COOLER_USES_AD595))
 #define HEATER_USES_MAX       (ENABLED(SUPPORT_MAX6675) || ENABLED(SUPPORT_MAX31855) || ENABLED(SUPPORT_MAX31865))
 #define HEATER_USES_AMPLIFIER (ENABLED(HEATER_0_USES_AMPLIFIER) || ENABLED(HEATER_1_USES_AMPLIFIER) || ENABLED(HEATER_2_USES_AMPLIFIER) || ENABLED(HEATER_3_USES_AMPLIFIER) || ENABLED(BED_USES_AMPLIFIER) || ENABLED(CHAMBER_USES_AMPLIFIER) || ENABLED(COOLER_USES_AMPLIFIER))
+#define HAS_THERMISTOR_TABLE  (ENABLED(THERMISTOR_TABLE_SIZE))
 
 /**
  * Heaters
@@ -1369,6 +1377,12 @@
   #define HEATER_PWM_MASK 240
 #endif
 
+// Heater duty resolution
+#if DISABLED(HEATER_PWM_RESOLUTION)
+  #define HEATER_PWM_RESOLUTION 8
+#endif
+#define HEATER_PWM_MAX ((1UL << (HEATER_PWM_RESOLUTION)) - 1)
+
 #if DISABLED(FAN_PWM_SPEED)
   #define FAN_PWM_SPEED 0
 #endif
@@ -221,6 +221,7 @@
 #define MSG_KP                              " Kp: "
 #define MSG_KI                              " Ki: "
 #define MSG_KD                              " Kd: "
+#define MSG_KL                              " Kl: "
 #define MSG_T                               " T:"
 #define MSG_B                               " B:"
 #define MSG_AT                              " @"
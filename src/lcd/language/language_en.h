@@ -125,6 +125,9 @@
 #ifndef MSG_PRINTING_TIME
   #define MSG_PRINTING_TIME              			_UxGT("Time elapsed: %s\\rEst. time left: %s")
 #endif
+#ifndef MSG_PRINTING_MATERIAL
+  #define MSG_PRINTING_MATERIAL          			_UxGT("Used: %.1f m plastic, %.1f m fiber")
+#endif
 
 #ifndef MSG_LAYER_NUMBER
   #define MSG_LAYER_NUMBER              			_UxGT("Layer: %d/%d - %d%%")
@@ -478,6 +481,10 @@
   #define MSG_PAUSE_DURING_FIBER                    _UxGT("Print can't be paused during fiber\\rprinting. Pause will be made after the\\rcurrent fiber reinforced path.")
 #endif
 
+#ifndef MSG_PAUSE_FIBER_WAIT
+  #define MSG_PAUSE_FIBER_WAIT                     _UxGT("Print will be paused after the\\rcurrent fiber reinforced path,\\rin about %s")
+#endif
+
 #ifndef MSG_WAITING_FOR_PAUSE
   #define MSG_WAITING_FOR_PAUSE                    _UxGT("Waiting for pause...")
 #endif
@@ -502,6 +509,10 @@
   #define MSG_DEBUG_INFO                 		_UxGT("X:%.2f Y:%.2f Z:%.2f\\rE:%.2f U:%.2f V:%.2f T%d\\rT0:%.2f/%d T1:%.2f/%d\\rTB:%.2f/%d TC:%.2f\\rF0:%d F1:%d F2:%d\\rXe:%d Ye:%d Ze:%d")
 #endif
 
+#ifndef MSG_DEBUG_TOOL_STATS
+  #define MSG_DEBUG_TOOL_STATS           		_UxGT("\\rJob T0:%lu %lums T1:%lu %lums\\rCut:%lu Park:%lu")
+#endif
+
 //Settings
 #ifndef MSG_COMP_EXTRUDER
   #define MSG_COMP_EXTRUDER                  _UxGT("Composite extruder offset")
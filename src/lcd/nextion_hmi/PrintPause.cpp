@@ -15,6 +15,138 @@ namespace {
 	static uint8_t resume_tool;
 	static uint8_t resume_fan_speed[FAN_COUNT];
 
+	// Look-ahead for the end of the fiber path
+	enum FiberScanState : uint8_t { SCAN_LINE, SCAN_TEXT, SCAN_PARAM, SCAN_VALUE };
+
+	static bool fiber_scanning = false;
+	static uint32_t fiber_scan_pos = 0,
+	                fiber_end_pos = 0;		// File position after M1002, 0 if not found yet
+	static FiberScanState scan_state = SCAN_LINE;
+	static bool scan_last_param = false;
+	static char scan_line[16];
+	static uint8_t scan_len = 0;
+
+	// The scan moves the file away from the print position, leave the SD
+	// to the print most of the time and only while its queue is well fed
+	#define FIBER_SCAN_INTERVAL		200				// ms between two chunks
+	#define FIBER_SCAN_QUEUED		(BUFSIZE / 2)	// Commands queued before a chunk is read
+	static uint8_t scan_buf[512];
+	static millis_l next_scan_ms = 0;
+
+	static bool IsFiberEnd(const char* p) {
+		int16_t code;
+		return commands.peek_command(p, code) == 'M' && code == 1002;
+	}
+
+	static bool FiberEndQueued() {
+		for (uint8_t i = 0; i < commands.buffer_ring.count(); i++)
+			if (IsFiberEnd(commands.queued_line(i))) return true;
+		return false;
+	}
+
+	static void StartFiberScan() {
+		fiber_end_pos = 0;
+		fiber_scanning = false;
+		#if HAS_SDSUPPORT
+		  if (!IS_SD_PRINTING) return;
+		  // Already read from the file, only the queued commands are left
+		  if (FiberEndQueued()) {
+			  fiber_end_pos = card.sdpos;
+			  return;
+		  }
+		  fiber_scan_pos = card.gcode_file.curPosition();
+		  scan_state = SCAN_LINE;
+		  scan_len = 0;
+		  fiber_scanning = true;
+		#endif
+	}
+
+	/**
+	 * Read the next chunk of the file after the print position, looking for M1002.
+	 * Packed move records are skipped by their structure, they can hold any byte.
+	 */
+	static void ScanFiberChunk() {
+		if (PENDING(millis(), next_scan_ms) || commands.buffer_ring.count() < FIBER_SCAN_QUEUED) return;
+		next_scan_ms = millis() + FIBER_SCAN_INTERVAL;
+
+		uint8_t * const buf = scan_buf;
+		const uint32_t print_pos = card.gcode_file.curPosition();
+		card.gcode_file.seekSet(fiber_scan_pos);
+		const int16_t len = card.gcode_file.read(buf, sizeof(scan_buf));
+		card.gcode_file.seekSet(print_pos);
+
+		if (len <= 0) {
+			// End of file, the print ends with the fiber path
+			fiber_end_pos = card.fileSize;
+			fiber_scanning = false;
+			return;
+		}
+
+		for (int16_t i = 0; i < len; i++) {
+			const uint8_t c = buf[i];
+			fiber_scan_pos++;
+			switch (scan_state) {
+				case SCAN_LINE:
+					#if HAS_SD_PACKED_GCODE
+					  if (card.packed_file && c >= 0x80) {
+						  scan_last_param = (c & 0x7E);
+						  if (!scan_last_param) scan_state = SCAN_PARAM;
+						  break;
+					  }
+					#endif
+					scan_state = SCAN_TEXT;
+					// no break
+				case SCAN_TEXT:
+					if (c == '\n') {
+						scan_line[scan_len] = '\0';
+						scan_len = 0;
+						scan_state = SCAN_LINE;
+						if (IsFiberEnd(scan_line)) {
+							fiber_end_pos = fiber_scan_pos;
+							fiber_scanning = false;
+							return;
+						}
+					}
+					else if (c != '\r' && scan_len < sizeof(scan_line) - 1)
+						scan_line[scan_len++] = c;
+					break;
+				case SCAN_PARAM:
+					scan_last_param = TEST(c, 7);
+					scan_state = SCAN_VALUE;
+					break;
+				case SCAN_VALUE:
+					if (!(c & 0x80)) scan_state = scan_last_param ? SCAN_LINE : SCAN_PARAM;
+					break;
+			}
+		}
+	}
+
+	static bool StartPause(const bool cut) {
+		fiber_scanning = false;
+
+        SERIAL_STR(PAUSE);
+        SERIAL_EOL();
+
+        // Pause the print job
+        #if HAS_SDSUPPORT
+          if (IS_SD_PRINTING) {
+            card.pauseSDPrint();
+            PrintPause::SdPrintingPaused = true;
+          }
+        #endif
+
+        print_job_counter.pause();
+
+        // Must be enqueued with pauseSDPrint set to be last in the buffer,
+        // the cut comes at the end of the queued moves
+        commands.inject_rear_P(cut ? PSTR("M1010\nM125") : PSTR("M125"));
+
+        PrintPause::Status = Pausing;
+        NextionHMI::RaiseEvent(PRINT_PAUSING);
+
+        return true;
+	}
+
 }
 
 float PrintPause::LoadDistance[DRIVER_EXTRUDERS] = { 0.0 };
@@ -57,33 +189,53 @@ bool PrintPause::PausePrint() {
     //Printing with fiber, can't pause now
     if (tools.printing_with_fiber)
     {
+    	if (Status==NotPaused) StartFiberScan();
     	Status = WaitingToPause;
     	NextionHMI::RaiseEvent(PRINT_PAUSE_SCHEDULED);
     	return false;
     }
     else
-    {
-        SERIAL_STR(PAUSE);
-        SERIAL_EOL();
-
-        // Pause the print job
-        #if HAS_SDSUPPORT
-          if (IS_SD_PRINTING) {
-            card.pauseSDPrint();
-            SdPrintingPaused = true;
-          }
-        #endif
-
-        print_job_counter.pause();
-
-        commands.inject_rear_P(PSTR("M125")); // Must be enqueued with pauseSDPrint set to be last in the buffer
-
-        Status = Pausing;
-        NextionHMI::RaiseEvent(PRINT_PAUSING);
+    	return StartPause(false);
+}
 
+/**
+ * Waiting for the end of the fiber path: look ahead in the file for M1002,
+ * report when the pause can be made, and with PAUSE_FIBER_MAX_WAIT cut the
+ * fiber and pause now if the end of the path is too far.
+ */
+void PrintPause::Spin() {
+
+	if (Status!=WaitingToPause) return;
+
+	#if HAS_SDSUPPORT
+	  if (fiber_scanning) {
+		  if (!IS_SD_PRINTING) { fiber_scanning = false; return; }
+		  ScanFiberChunk();
+		  if (fiber_end_pos) SERIAL_LMV(ECHO, "Pause at the end of the fiber path, s:", FiberWaitTime());
+	  }
+
+	  #if PAUSE_FIBER_MAX_WAIT > 0
+		// While scanning the time is a lower bound
+		if (FiberWaitTime() > PAUSE_FIBER_MAX_WAIT) {
+			SERIAL_LM(ECHO, "Fiber path too long, cut and pause");
+			StartPause(true);
+		}
+	  #endif
+	#endif
+}
 
-        return true;
-    }
+/**
+ * Seconds to the end of the fiber path at the average rate of the print
+ * so far, 0 if unknown.
+ */
+uint32_t PrintPause::FiberWaitTime() {
+	#if HAS_SDSUPPORT
+	  const uint32_t end_pos = fiber_end_pos ? fiber_end_pos : fiber_scanning ? fiber_scan_pos : 0;
+	  if (Status!=WaitingToPause || !card.sdpos || end_pos <= card.sdpos) return 0;
+	  return (uint64_t)(end_pos - card.sdpos) * print_job_counter.duration() / card.sdpos;
+	#else
+	  return 0;
+	#endif
 }
 
 
@@ -177,6 +329,7 @@ void PrintPause::ResumePrint(const float& purge_length) {
 
    if (Status==WaitingToPause)
    {
+	   fiber_scanning = false;
 	   Status = NotPaused;
 	   NextionHMI::RaiseEvent(PRINT_PAUSE_UNSCHEDULED);
 	   return;
@@ -28,6 +28,8 @@ namespace PrintPause {
   void DoPauseExtruderMove(AxisEnum axis, const float &length, const float fr);
 
   bool PausePrint();
+  void Spin();
+  uint32_t FiberWaitTime();
   bool ParkHead(const float &retract);
   void ResumePrint(const float& purge_length=0);
   void RestoreTemperatures();
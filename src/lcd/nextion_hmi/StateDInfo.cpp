@@ -64,6 +64,13 @@ void StateDInfo::DrawUpdate() {
 			fans[0].Speed, fans[1].Speed, fans[2].Speed, \
 			Xe, Ye, Ze);
 
+	// Tool changes of the job, count and mean time
+	const toolStatistics &job = print_job_counter.toolJob;
+	sprintf_P(NextionHMI::buffer + strlen(NextionHMI::buffer), PSTR(MSG_DEBUG_TOOL_STATS), \
+			(unsigned long)job.changes[0], (unsigned long)(job.changes[0] ? job.changeTime[0] / job.changes[0] : 0), \
+			(unsigned long)job.changes[1], (unsigned long)(job.changes[1] ? job.changeTime[1] / job.changes[1] : 0), \
+			(unsigned long)job.cuts, (unsigned long)job.parks);
+
 	_tT.setText(NextionHMI::buffer);
 }
 
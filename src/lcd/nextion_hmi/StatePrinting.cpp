@@ -245,9 +245,19 @@ void StatePrinting::DrawUpdate() {
 			time = (printer.progress > 0) ? duration_t(_previousDuration * (100 - printer.progress) / (printer.progress + 0.1)) : duration_t(0);
 			time.toDigital(bufferLeft, false);
 			sprintf_P(NextionHMI::buffer, PSTR(MSG_PRINTING_TIME), bufferElapsed, bufferLeft);
+			// Material extruded so far
+			sprintf_P(NextionHMI::buffer + strlen(NextionHMI::buffer), PSTR("\\r" MSG_PRINTING_MATERIAL), print_job_counter.jobMaterial(true) * 0.001, print_job_counter.jobMaterial(false) * 0.001);
 
 			_tStatus2.setText(NextionHMI::buffer);
 		  }
+		else if (PrintPause::FiberWaitTime())
+		{
+			char bufferWait[10];
+			duration_t(PrintPause::FiberWaitTime()).toDigital(bufferWait, false);
+			ZERO(NextionHMI::buffer);
+			sprintf_P(NextionHMI::buffer, PSTR(MSG_PAUSE_FIBER_WAIT), bufferWait);
+			_tStatus2.setText(NextionHMI::buffer);
+		}
 
     	auto strTemp = String(round(heaters[HOT0_INDEX].current_temperature)) + "\370C";
         _tTempPlastic.setText(strTemp.c_str());
@@ -3243,6 +3243,20 @@ FAIL:
   return false;
 }
 
+#if HAS_SD_IO_STATS
+
+  sd_card_stats_t Sd2Card::stats;
+
+  // Time of one block read, bin n of the histogram is below 256us << n
+  static void sd_stats_read_time(const uint32_t us) {
+    uint8_t bin = 0;
+    for (uint32_t t = us >> 8; t && bin < SD_STATS_LATENCY_BINS - 1; t >>= 1) bin++;
+    Sd2Card::stats.read_hist[bin]++;
+    NOLESS(Sd2Card::stats.read_max_us, us);
+  }
+
+#endif
+
 /**
  * Read a 512 byte block from an SD card.
  *
@@ -3255,29 +3269,58 @@ bool Sd2Card::readBlock(uint32_t blockNumber, uint8_t* dst) {
   // use address if not SDHC card
   if (type()!= SD_CARD_TYPE_SDHC) blockNumber <<= 9;
 
+  #if HAS_SD_IO_STATS
+    const uint32_t read_start = micros();
+  #endif
+
   #if ENABLED(SD_CHECK_AND_RETRY)
     uint8_t retryCnt = 3;
     for(;;) {
       if (cardCommand(CMD17, blockNumber))
         error(SD_CARD_ERROR_CMD17);
-      else if (readData(dst, 512))
+      else if (readData(dst, 512)) {
+        #if HAS_SD_IO_STATS
+          stats.blocks_read++;
+          sd_stats_read_time(micros() - read_start);
+        #endif
         return true;
+      }
 
       chipDeselect();
       if (!--retryCnt) break;
 
+      #if HAS_SD_IO_STATS
+        stats.read_retries++;
+      #endif
+
       cardCommand(CMD12, 0); // Try sending a stop command, ignore the result.
       errorCode_ = 0;
     }
+    #if HAS_SD_IO_STATS
+      stats.read_errors++;
+    #endif
     return false;
   #else
     if (cardCommand(CMD17, blockNumber)) {
       error(SD_CARD_ERROR_CMD17);
       chipDeselect();
+      #if HAS_SD_IO_STATS
+        stats.read_errors++;
+      #endif
       return false;
     }
-    else
-      return readData(dst, 512);
+    else {
+      const bool ok = readData(dst, 512);
+      #if HAS_SD_IO_STATS
+        if (ok) {
+          stats.blocks_read++;
+          sd_stats_read_time(micros() - read_start);
+        }
+        else
+          stats.read_errors++;
+      #endif
+      return ok;
+    }
   #endif
 }
 
@@ -3290,6 +3333,9 @@ bool Sd2Card::readBlock(uint32_t blockNumber, uint8_t* dst) {
  */
 bool Sd2Card::readData(uint8_t* dst) {
   chipSelect();
+  #if HAS_SD_IO_STATS
+    stats.blocks_read++;
+  #endif
   return readData(dst, 512);
 }
 
@@ -3359,12 +3405,18 @@ bool Sd2Card::readData(uint8_t* dst) {
 bool Sd2Card::readData(uint8_t* dst, size_t count) {
   // wait for start block token
   uint16_t t0 = millis();
+  #if HAS_SD_IO_STATS
+    const uint32_t wait_start = micros();
+  #endif
   while ((status_ = HAL::spiReceive()) == 0xFF) {
     if (((uint16_t)millis() - t0) > SD_READ_TIMEOUT) {
       error(SD_CARD_ERROR_READ_TIMEOUT);
       goto FAIL;
     }
   }
+  #if HAS_SD_IO_STATS
+    stats.busy_us += micros() - wait_start;
+  #endif
   if (status_ != DATA_START_BLOCK) {
     error(SD_CARD_ERROR_READ);
     goto FAIL;
@@ -3377,6 +3429,9 @@ bool Sd2Card::readData(uint8_t* dst, size_t count) {
       uint16_t recvCrc = (HAL::spiReceive() << 8) | HAL::spiReceive();
       if (crcSupported && recvCrc != CRC_CCITT(dst, count)) {
         error(SD_CARD_ERROR_READ_CRC);
+        #if HAS_SD_IO_STATS
+          stats.crc_errors++;
+        #endif
         goto FAIL;
       }
     }
@@ -3469,10 +3524,23 @@ bool Sd2Card::setSckRate(uint8_t sckRateID) {
 // wait for card to go not busy
 bool Sd2Card::waitNotBusy(uint32_t timeoutMillis) {
   uint32_t t0 = millis();
-  while (HAL::spiReceive() != 0xFF) {
-    if (((uint32_t)millis() - t0) >= timeoutMillis) return false;
-  }
-  return true;
+  #if HAS_SD_IO_STATS
+    const uint32_t wait_start = micros();
+    bool ready = true;
+    while (HAL::spiReceive() != 0xFF) {
+      if (((uint32_t)millis() - t0) >= timeoutMillis) {
+        ready = false;
+        break;
+      }
+    }
+    stats.busy_us += micros() - wait_start;
+    return ready;
+  #else
+    while (HAL::spiReceive() != 0xFF) {
+      if (((uint32_t)millis() - t0) >= timeoutMillis) return false;
+    }
+    return true;
+  #endif
 }
 
 /**
@@ -3545,6 +3613,9 @@ bool Sd2Card::writeData(uint8_t token, const uint8_t* src) {
     chipDeselect();
     return false;
   }
+  #if HAS_SD_IO_STATS
+    stats.blocks_written++;
+  #endif
   return true;
 }
 
@@ -3612,6 +3683,9 @@ uint8_t  SdVolume::cacheFatStatus_;       // status of cache Fatblock
 #endif  // USE_SEPARATE_FAT_CACHE
 Sd2Card* SdVolume::sdCard_;            // pointer to SD card object
 #endif  // USE_MULTIPLE_CARDS
+#if HAS_SD_IO_STATS
+SdVolume::cache_stats_t SdVolume::stats;
+#endif
 //------------------------------------------------------------------------------
 // find a contiguous group of clusters
 bool SdVolume::allocContiguous(uint32_t count, uint32_t* curCluster) {
@@ -3712,6 +3786,9 @@ cache_t* SdVolume::cacheFetch(uint32_t blockNumber, uint8_t options) {
 }
 //------------------------------------------------------------------------------
 cache_t* SdVolume::cacheFetchData(uint32_t blockNumber, uint8_t options) {
+  #if HAS_SD_IO_STATS
+    if (cacheBlockNumber_ == blockNumber) stats.data_hits++; else stats.data_misses++;
+  #endif
   if (cacheBlockNumber_ != blockNumber) {
     if (!cacheWriteData()) {
       DBG_FAIL_MACRO;
@@ -3734,6 +3811,9 @@ FAIL:
 }
 //------------------------------------------------------------------------------
 cache_t* SdVolume::cacheFetchFat(uint32_t blockNumber, uint8_t options) {
+  #if HAS_SD_IO_STATS
+    if (cacheFatBlockNumber_ == blockNumber) stats.fat_hits++; else stats.fat_misses++;
+  #endif
   if (cacheFatBlockNumber_ != blockNumber) {
     if (!cacheWriteFat()) {
       DBG_FAIL_MACRO;
@@ -3797,6 +3877,16 @@ FAIL:
 #else  // USE_SEPARATE_FAT_CACHE
 //------------------------------------------------------------------------------
 cache_t* SdVolume::cacheFetch(uint32_t blockNumber, uint8_t options) {
+  #if HAS_SD_IO_STATS
+    // Data and FAT blocks share the cache, cacheFetchFat() marks the FAT ones
+    const bool hit = cacheBlockNumber_ == blockNumber;
+    if (options & CACHE_STATUS_FAT_BLOCK) {
+      if (hit) stats.fat_hits++; else stats.fat_misses++;
+    }
+    else {
+      if (hit) stats.data_hits++; else stats.data_misses++;
+    }
+  #endif
   if (cacheBlockNumber_ != blockNumber) {
     if (!cacheSync()) {
       DBG_FAIL_MACRO;
@@ -601,6 +601,28 @@
     uint8_t const SD_CHIP_SELECT_PIN = SOFT_SPI_CS_PIN;
   #endif  // SOFTWARE_SPI
   //------------------------------------------------------------------------------
+  #if HAS_SD_IO_STATS
+    /** Number of bins of the block read latency histogram */
+    #define SD_STATS_LATENCY_BINS 8
+    /**
+     * \struct sd_card_stats_t
+     * \brief Counters of the raw card access.
+     *
+     * Bin n of read_hist counts the block reads that took less than 256us << n,
+     * the last bin all the slower ones.
+     */
+    struct sd_card_stats_t {
+      uint32_t  blocks_read,
+                blocks_written,
+                read_retries,
+                read_errors,
+                crc_errors,
+                busy_us,
+                read_max_us,
+                read_hist[SD_STATS_LATENCY_BINS];
+    };
+  #endif
+  //------------------------------------------------------------------------------
   /**
    * \class Sd2Card
    * \brief Raw access to SD and SDHC flash memory cards.
@@ -676,6 +698,11 @@
     bool writeStart(uint32_t blockNumber, uint32_t eraseCount);
     bool writeStop();
 
+    #if HAS_SD_IO_STATS
+      /** Counters of the card access, shared by all the cards */
+      static sd_card_stats_t stats;
+    #endif
+
    private:
 
     uint8_t chipSelectPin_,
@@ -1401,6 +1428,17 @@
      * \return true for success or false for failure
      */
     bool dbgFat(uint32_t n, uint32_t* v) {return fatGet(n, v);}
+
+    #if HAS_SD_IO_STATS
+      /** Block cache hits and misses, for data and for FAT blocks */
+      struct cache_stats_t {
+        uint32_t  data_hits,
+                  data_misses,
+                  fat_hits,
+                  fat_misses;
+      };
+      static cache_stats_t stats;
+    #endif
   //------------------------------------------------------------------------------
    private:
     // Allow SdBaseFile access to SdVolume private data.
@@ -48,6 +48,15 @@
     fileSize = 0;
     sdpos = 0;
 
+    #if HAS_SD_PACKED_GCODE
+      packed_file = false;
+      packed_line_start = true;
+    #endif
+
+    #if HAS_SD_DIR_CACHE
+      dir_cache_flush();
+    #endif
+
     clearFileInfo();
 
     workDirDepth = 0;
@@ -67,6 +76,14 @@
     cardOK = false;
     if (root.isOpen()) root.close();
 
+    #if HAS_SD_DIR_CACHE
+      dir_cache_flush();
+    #endif
+
+    #if HAS_SD_RESTART
+      restart.close_journal();
+    #endif
+
     if (!fat.begin(SDSS, SD_SPI_SPEED)
       #if ENABLED(LCD_SDSS) && (LCD_SDSS != SDSS)
         && !fat.begin(LCD_SDSS, SPI_SPEED)
@@ -86,6 +103,12 @@
   void CardReader::unmount() {
     cardOK = false;
     sdprinting = false;
+    #if HAS_SD_DIR_CACHE
+      dir_cache_flush();
+    #endif
+    #if HAS_SD_RESTART
+      restart.close_journal();
+    #endif
   }
 
   void CardReader::ls()  {
@@ -96,7 +119,20 @@
   }
 
   void CardReader::getfilename(uint16_t nr, const char* const match/*=NULL*/) {
-    #if ENABLED(SDCARD_SORT_ALPHA) && ENABLED(SDSORT_CACHE_NAMES)
+    #if HAS_SD_DIR_CACHE
+      if (dir_cache_select()) {
+        const dir_cache_t &slot = *dir_cache_current;
+        if (match != NULL) {
+          for (nr = 0; nr < slot.cached; nr++)
+            if (strcasecmp(match, slot.entry[nr].name) == 0) break;
+        }
+        if (nr < slot.cached) {
+          strcpy(fileName, slot.entry[nr].name);
+          filenameIsDir = slot.entry[nr].isDir;
+          return;
+        }
+      }
+    #elif ENABLED(SDCARD_SORT_ALPHA) && ENABLED(SDSORT_CACHE_NAMES)
       if (match != NULL) {
         while (nr < sort_count) {
           if (strcasecmp(match, sortshort[nr]) == 0) break;
@@ -138,6 +174,13 @@
   void CardReader::startFileprint() {
     if (cardOK) {
       sdprinting = true;
+      #if HAS_SD_RESTART
+        restart.cmd_sdpos = sdpos;
+      #endif
+      #if HAS_SD_IO_STATS
+        // A new print, not a resume after pause
+        if (!print_job_counter.isPaused()) reset_io_stats();
+      #endif
       #if ENABLED(SDCARD_SORT_ALPHA)
         flush_presort();
       #endif
@@ -188,6 +231,54 @@
       SERIAL_EM(MSG_SD_NOT_PRINTING);
   }
 
+  #if HAS_SD_IO_STATS
+
+    void CardReader::reset_io_stats() {
+      memset(&Sd2Card::stats, 0, sizeof(Sd2Card::stats));
+      memset(&SdVolume::stats, 0, sizeof(SdVolume::stats));
+      stats_start_sdpos       = sdpos;
+      stats_queue_empty_count = 0;
+      stats_queue_empty_ms    = 0;
+      stats_queue_empty       = false;
+    }
+
+    void CardReader::print_io_stats() {
+      const sd_card_stats_t &cs = Sd2Card::stats;
+      const SdVolume::cache_stats_t &vs = SdVolume::stats;
+
+      SERIAL_MV("SD blocks read:", cs.blocks_read);
+      SERIAL_MV(" written:", cs.blocks_written);
+      SERIAL_MV(" retries:", cs.read_retries);
+      SERIAL_MV(" read errors:", cs.read_errors);
+      SERIAL_EMV(" CRC errors:", cs.crc_errors);
+
+      SERIAL_MV("SD busy wait ms:", cs.busy_us / 1000UL);
+      SERIAL_EMV(" slowest read us:", cs.read_max_us);
+
+      SERIAL_MSG("SD read us");
+      for (uint8_t i = 0; i < SD_STATS_LATENCY_BINS - 1; i++) {
+        SERIAL_MV(" <", 256UL << i);
+        SERIAL_MV(":", cs.read_hist[i]);
+      }
+      SERIAL_MV(" >=", 256UL << (SD_STATS_LATENCY_BINS - 1));
+      SERIAL_EMV(":", cs.read_hist[SD_STATS_LATENCY_BINS - 1]);
+
+      SERIAL_MV("SD cache data hits:", vs.data_hits);
+      SERIAL_MV(" misses:", vs.data_misses);
+      SERIAL_MV(" FAT hits:", vs.fat_hits);
+      SERIAL_EMV(" misses:", vs.fat_misses);
+
+      const uint32_t bytes = sdpos > stats_start_sdpos ? sdpos - stats_start_sdpos : 0,
+                     seconds = print_job_counter.duration();
+      SERIAL_MV("SD print bytes:", bytes);
+      SERIAL_MV(" seconds:", seconds);
+      SERIAL_MV(" bytes/s:", seconds ? bytes / seconds : 0UL);
+      SERIAL_MV(" queue empty ms:", stats_queue_empty_ms + (stats_queue_empty ? millis() - stats_queue_empty_start : 0UL));
+      SERIAL_EMV(" times:", stats_queue_empty_count);
+    }
+
+  #endif // HAS_SD_IO_STATS
+
   void CardReader::startWrite(char *filename, const bool silent/*=false*/) {
     if (!cardOK) return;
 
@@ -199,6 +290,9 @@
     }
     else {
       saving = true;
+      #if HAS_SD_DIR_CACHE
+        dir_cache_flush();
+      #endif
       if (!silent) {
         SERIAL_EMT(MSG_SD_WRITE_TO_FILE, filename);
         lcd_setstatus(filename);
@@ -206,10 +300,46 @@
     }
   }
 
+  #if HAS_FILE_TRANSFER
+
+    /**
+     * Open a file for a binary upload. With a known size the clusters
+     * are allocated contiguously in advance, if the card has room for it.
+     */
+    bool CardReader::startBinaryWrite(char *filename, const uint32_t size) {
+      if (!cardOK || sdprinting || saving) return false;
+
+      gcode_file.close();
+      #if HAS_SD_DIR_CACHE
+        dir_cache_flush();
+      #endif
+
+      if (size) {
+        // createContiguous() does not overwrite, remove any old copy first
+        SdBaseFile old_file;
+        if (old_file.open(curDir, filename, O_WRITE)) old_file.remove();
+        if (gcode_file.createContiguous(curDir, filename, size)) return true;
+      }
+
+      return gcode_file.open(curDir, filename, O_CREAT | O_WRITE | O_TRUNC);
+    }
+
+    void CardReader::abortBinaryWrite() {
+      if (gcode_file.isOpen() && !gcode_file.remove()) gcode_file.close();
+      #if HAS_SD_DIR_CACHE
+        dir_cache_flush();
+      #endif
+    }
+
+  #endif // HAS_FILE_TRANSFER
+
   void CardReader::deleteFile(char *filename) {
     if (!cardOK) return;
     sdprinting = false;
     gcode_file.close();
+    #if HAS_SD_DIR_CACHE
+      dir_cache_flush();
+    #endif
     if (fat.remove(filename)) {
       SERIAL_EMT(MSG_SD_FILE_DELETED, filename);
     }
@@ -230,6 +360,9 @@
     gcode_file.sync();
     gcode_file.close();
     saving = false;
+    #if HAS_SD_DIR_CACHE
+      dir_cache_flush();
+    #endif
     SERIAL_EM(MSG_SD_FILE_SAVED);
   }
 
@@ -237,6 +370,9 @@
     if (!cardOK) return;
     sdprinting = false;
     gcode_file.close();
+    #if HAS_SD_DIR_CACHE
+      dir_cache_flush();
+    #endif
     if (fat.mkdir(filename)) {
       SERIAL_EM(MSG_SD_DIRECTORY_CREATED);
     }
@@ -257,12 +393,7 @@
     sdprinting = false;
 
     #if HAS_SD_RESTART
-      open_restart_file(false);
-      restart.job_info.valid_head = 0;
-      restart.job_info.valid_foot = 0;
-      (void)save_restart_data();
-      close_restart_file();
-      restart.count = 0;
+      restart.end_job();
     #endif
 
     #if SD_FINISHED_STEPPERRELEASE && ENABLED(SD_FINISHED_RELEASECOMMAND)
@@ -379,6 +510,14 @@
       fileSize = gcode_file.fileSize();
       sdpos = 0;
 
+      #if HAS_SD_PACKED_GCODE
+        char header[10];
+        packed_file = gcode_file.read(header, sizeof(header)) == sizeof(header)
+                      && !strncmp_P(header, PSTR(";PACKED 1"), 9) && (header[9] == '\n' || header[9] == '\r');
+        packed_line_start = true;
+        gcode_file.seekSet(0);
+      #endif
+
       SERIAL_MT(MSG_SD_FILE_OPENED, fname);
       SERIAL_EMV(MSG_SD_SIZE, fileSize);
 
@@ -405,6 +544,82 @@
     }
   }
 
+  #if HAS_SD_PACKED_GCODE
+
+    /**
+     * Packed G-code: text lines are kept as they are, G0/G1 moves may be
+     * replaced by a binary record starting at the beginning of a line:
+     *
+     *   code    0x80 | G number (0 or 1)
+     *   params  for each parameter, in the order of the original line:
+     *           header  bits 0-2 letter (X Y Z E F), bits 3-5 decimals,
+     *                   bit 6 integer zero omitted (".5"), bit 7 last parameter
+     *           value   parameter * 10^decimals as zigzag varint (7 bits per byte, LSB first)
+     *
+     * The record expands to "G<n> <letter><value> ...", the exact text
+     * of the original line, and sdpos is left on the following byte.
+     */
+    uint8_t CardReader::unpack_line(const uint8_t code, char* buf) {
+      static const char param_letter[] PROGMEM = "XYZEF";
+
+      uint8_t len = 0;
+      bool last = true;
+      if (!(code & 0x7E)) {             // Only G0 and G1 are defined
+        buf[len++] = 'G';
+        buf[len++] = '0' + (code & 0x01);
+        last = false;
+      }
+      for (uint8_t p = 0; !last; p++) {
+
+        const int16_t header = gcode_file.read();
+        if (header < 0 || (header & 0x07) > 4 || p >= 8) { len = 0; break; }
+
+        uint32_t raw = 0;
+        int16_t b;
+        uint8_t shift = 0;
+        do {
+          b = gcode_file.read();
+          if (b < 0 || shift > 28) break;
+          raw |= uint32_t(b & 0x7F) << shift;
+          shift += 7;
+        } while (b & 0x80);
+        if (b < 0 || (b & 0x80)) { len = 0; break; }
+
+        const int32_t value = int32_t(raw >> 1) ^ -int32_t(raw & 1);
+        const uint8_t decimals = (header >> 3) & 0x07;
+        last = TEST(header, 7);
+
+        // Digits in reverse order, padded to have at least one integer digit
+        char digits[12];
+        uint32_t mag = value < 0 ? -uint32_t(value) : uint32_t(value);
+        uint8_t nd = 0;
+        do { digits[nd++] = '0' + mag % 10; mag /= 10; } while (mag);
+        while (nd <= decimals) digits[nd++] = '0';
+
+        if (len + nd + 4 >= MAX_CMD_SIZE) { len = 0; break; }
+
+        buf[len++] = ' ';
+        buf[len++] = pgm_read_byte(&param_letter[header & 0x07]);
+        if (value < 0) buf[len++] = '-';
+        uint8_t i = nd;
+        if (TEST(header, 6) && nd == decimals + 1 && digits[decimals] == '0') i--;
+        while (i > decimals) buf[len++] = digits[--i];
+        if (decimals) {
+          buf[len++] = '.';
+          while (i) buf[len++] = digits[--i];
+        }
+      }
+
+      sdpos = gcode_file.curPosition();
+      packed_line_start = true;
+
+      if (!len) SERIAL_LMV(ER, "Bad packed line at ", sdpos);
+
+      return len;
+    }
+
+  #endif // HAS_SD_PACKED_GCODE
+
   int8_t CardReader::updir() {
     if (workDirDepth > 0) {                                               // At least 1 dir has been saved
       workDir = --workDirDepth ? workDirParents[workDirDepth - 1] : root; // Use parent, or root if none
@@ -416,6 +631,9 @@
   }
 
   uint16_t CardReader::getnrfilenames() {
+    #if HAS_SD_DIR_CACHE
+      if (dir_cache_select()) return dir_cache_current->count;
+    #endif
     curDir = &workDir;
     lsAction = LS_Count;
     nrFiles = 0;
@@ -436,43 +654,40 @@
 
   #if HAS_SD_RESTART
 
-    void CardReader::open_restart_file(const bool read) {
-
-      if (!cardOK || restart_file.isOpen()) return;
-
-      if (!restart_file.open(&root, "restart.bin", read ? O_READ : O_CREAT | O_WRITE | O_TRUNC | O_SYNC))
-        SERIAL_SM(ER, MSG_SD_OPEN_FILE_FAIL);
-		#if ENABLED(NEXTION_HMI)
-			NextionHMI::RaiseEvent(HMIevent::SD_ERROR, 0, MSG_SD_OPEN_FILE_FAIL);
-		#endif
-      else
-        SERIAL_MSG(MSG_SD_WRITE_TO_FILE);
-
-      SERIAL_EM("restart.bin");
-    }
-
-    void CardReader::close_restart_file() { restart_file.close(); }
-
-    void CardReader::delete_restart_file() {
-      if (restart_file.remove(&root, "restart.bin")) {
-        SERIAL_EM("restart.bin deleted");
-      }
-      else {
-        SERIAL_EM("Deletion restart.bin failed");
+    /**
+     * restart.bin is allocated once in contiguous clusters and then written
+     * by block, so the saves never update the FAT or the directory.
+     * Return the first block of the file, created is true for a new file.
+     */
+    bool CardReader::open_restart_journal(uint32_t &first_block, bool &created) {
+
+      if (!cardOK) return false;
+
+      const uint32_t size = uint32_t(SD_RESTART_JOURNAL_BLOCKS) * 512UL;
+      uint32_t end_block;
+
+      created = false;
+      bool found = restart_file.open(&root, "restart.bin", O_READ)
+                   && restart_file.fileSize() == size
+                   && restart_file.contiguousRange(&first_block, &end_block);
+      restart_file.close();
+
+      if (!found) {
+        SdBaseFile::remove(&root, "restart.bin");
+        found = restart_file.createContiguous(&root, "restart.bin", size)
+                && restart_file.contiguousRange(&first_block, &end_block);
+        restart_file.close();
+        #if HAS_SD_DIR_CACHE
+          dir_cache_flush();
+        #endif
+        if (!found) {
+          SERIAL_LMT(ER, MSG_SD_OPEN_FILE_FAIL, "restart.bin");
+          return false;
+        }
+        created = true;
       }
-    }
-
-    bool CardReader::exist_restart_file() {
-      return restart_file.open(&root, "restart.bin", O_READ);
-    }
-
-    int16_t CardReader::save_restart_data() {
-      restart_file.seekSet(0);
-      return restart_file.write(&restart.job_info, sizeof(restart.job_info));
-    }
 
-    int16_t CardReader::read_restart_data() {
-      return restart_file.read(&restart.job_info, sizeof(restart.job_info));
+      return true;
     }
 
   #endif
@@ -732,6 +947,13 @@
      * Get the name of a file in the current directory by sort-index
      */
     void CardReader::getfilename_sorted(const uint16_t nr) {
+      #if HAS_SD_DIR_CACHE
+        if (dir_cache_select()) {
+          const dir_cache_t &slot = *dir_cache_current;
+          getfilename(nr < slot.cached ? slot.order[nr] : nr);
+          return;
+        }
+      #endif
       getfilename(
         #if ENABLED(SDSORT_GCODE)
           sort_alpha &&
@@ -750,6 +972,13 @@
      */
     void CardReader::presort() {
 
+      // The folder cache keeps its own sort index, built once per folder
+      #if HAS_SD_DIR_CACHE
+
+        (void)dir_cache_select();
+
+      #else
+
       // Sorting may be turned off
       #if ENABLED(SDSORT_GCODE)
         if (!sort_alpha) return;
@@ -923,6 +1152,8 @@
 
         sort_count = fileCnt;
       }
+
+      #endif // !HAS_SD_DIR_CACHE
     }
 
     void CardReader::flush_presort() {
@@ -936,6 +1167,122 @@
 
   #endif // SDCARD_SORT_ALPHA
 
+  #if HAS_SD_DIR_CACHE
+
+    /**
+     * Make dir_cache_current point to the listing of workDir.
+     *
+     * A slot is reused while its first cluster matches and it was loaded
+     * after the last card change, otherwise the least recently used slot
+     * is reloaded with one pass over the folder.
+     * The card cannot be changed behind the firmware's back: mount, unmount
+     * and every write done by the firmware go through dir_cache_flush(),
+     * so the check never accesses the card.
+     */
+    bool CardReader::dir_cache_select() {
+      if (!cardOK || !workDir.isOpen()) return false;
+
+      const uint32_t cluster = workDir.firstCluster();
+
+      if (dir_cache_current && dir_cache_current->stamp == dir_cache_changes && dir_cache_current->cluster == cluster)
+        return true;
+
+      dir_cache_t *slot = &dir_cache[0];
+      for (uint8_t s = 0; s < SD_DIR_CACHE_SLOTS; s++) {
+        dir_cache_t &c = dir_cache[s];
+        const bool valid = c.stamp == dir_cache_changes;
+        if (valid && c.cluster == cluster) {
+          slot = &c;
+          break;
+        }
+        if (!valid || (slot->stamp == dir_cache_changes && c.used < slot->used)) slot = &c;
+      }
+
+      if (slot->stamp != dir_cache_changes || slot->cluster != cluster) {
+        slot->cluster = cluster;
+        dir_cache_load(*slot);
+      }
+
+      slot->used = ++dir_cache_uses;
+      dir_cache_current = slot;
+      return true;
+    }
+
+    void CardReader::dir_cache_load(dir_cache_t &slot) {
+      SdBaseFile dir = workDir;
+      dir_t* p = NULL;
+
+      slot.count = slot.cached = 0;
+
+      dir.rewind();
+      while ((p = dir.getLongFilename(p, fileName)) != NULL) {
+        if (p->name[0] == DIR_NAME_FREE) break;
+        if (!lsVisible(p)) continue;
+
+        // Items beyond the limit are counted and read from the SD when requested
+        if (slot.cached < SD_DIR_CACHE_LIMIT) {
+          dir_cache_entry_t &e = slot.entry[slot.cached];
+          strncpy(e.name, fileName, sizeof(e.name) - 1);
+          e.name[sizeof(e.name) - 1] = '\0';
+          e.isDir = DIR_IS_SUBDIR(p);
+          e.date  = p->lastWriteDate;
+          e.time  = p->lastWriteTime;
+          e.size  = p->fileSize;
+          slot.cached++;
+        }
+        slot.count++;
+      }
+
+      dir_cache_sort(slot);
+      slot.stamp = dir_cache_changes;
+    }
+
+    /**
+     * Insertion sort of the cached items, folders first or last
+     * according to FOLDER_SORTING (or M36 with SDSORT_GCODE).
+     */
+    void CardReader::dir_cache_sort(dir_cache_t &slot) {
+      for (uint16_t i = 0; i < slot.cached; i++) slot.order[i] = i;
+
+      #if ENABLED(SDCARD_SORT_ALPHA)
+
+        #if ENABLED(SDSORT_GCODE)
+          if (!sort_alpha) return;
+          const int fs = sort_folders;
+        #elif HAS_FOLDER_SORTING
+          const int fs = FOLDER_SORTING;
+        #else
+          const int fs = 0;
+        #endif
+
+        for (uint16_t i = 1; i < slot.cached; i++) {
+          const uint8_t o = slot.order[i];
+          const dir_cache_entry_t &e = slot.entry[o];
+          uint16_t j = i;
+          for (; j > 0; j--) {
+            const dir_cache_entry_t &prev = slot.entry[slot.order[j - 1]];
+            bool before;
+            if (fs && e.isDir != prev.isDir)
+              before = (fs < 0) ? e.isDir : prev.isDir;
+            else
+              before = strcasecmp(e.name, prev.name) < 0;
+            if (!before) break;
+            slot.order[j] = slot.order[j - 1];
+          }
+          slot.order[j] = o;
+        }
+
+      #endif // SDCARD_SORT_ALPHA
+    }
+
+    void CardReader::dir_cache_flush() {
+      dir_cache_changes++;  // Every loaded slot is now stale
+      dir_cache_current = NULL;
+      dir_cache_uses = 0;
+    }
+
+  #endif // HAS_SD_DIR_CACHE
+
   // Private Function
   /**
    * Dive into a folder and recurse depth-first to perform a pre-set operation lsAction:
@@ -948,17 +1295,11 @@
 
     // Read the next entry from a directory
     while ((p = parent.getLongFilename(p, fileName)) != NULL) {
-      uint8_t pn0 = p->name[0];
-      if (pn0 == DIR_NAME_FREE) break;
-
-      // ignore hidden or deleted files:
-      if (pn0 == DIR_NAME_DELETED || pn0 == '.') continue;
-      if (fileName[0] == '.') continue;
-      if (!DIR_IS_FILE_OR_SUBDIR(p) || (p->attributes & DIR_ATT_HIDDEN)) continue;
+      if (p->name[0] == DIR_NAME_FREE) break;
+      if (!lsVisible(p)) continue;
 
       filenameIsDir = DIR_IS_SUBDIR(p);
 
-      if (!filenameIsDir && (p->name[8] != 'G' || p->name[9] == '~')) continue;
       switch (lsAction) {
         case LS_Count:
           nrFiles++;
@@ -975,6 +1316,17 @@
     } // while readDir
   }
 
+  /**
+   * Only folders and G-code files are listed: hidden, deleted
+   * and dot entries are skipped.
+   */
+  bool CardReader::lsVisible(const dir_t* p) {
+    const uint8_t pn0 = p->name[0];
+    if (pn0 == DIR_NAME_DELETED || pn0 == '.' || fileName[0] == '.') return false;
+    if (!DIR_IS_FILE_OR_SUBDIR(p) || (p->attributes & DIR_ATT_HIDDEN)) return false;
+    return DIR_IS_SUBDIR(p) || (p->name[8] == 'G' && p->name[9] != '~');
+  }
+
   // --------------------------------------------------------------- //
   // Code that gets gcode information is adapted from RepRapFirmware //
   // Originally licenced under GPL                                   //
@@ -58,6 +58,34 @@
 	  PrintFileExtruderInfo ExtruderInfo[HOTENDS];
   };
 
+  #if HAS_SD_DIR_CACHE
+    /**
+     * Cached folder listing
+     * One slot holds the visible items of a folder in directory order plus
+     * the sorted index, and is keyed by the folder's first cluster and
+     * the card change count it was loaded at.
+     * RAM: SD_DIR_CACHE_LIMIT * (sizeof(dir_cache_entry_t) + 1) per slot,
+     * that is 77 bytes per item with SCROLL_LONG_FILENAMES, 37 without.
+     */
+    struct dir_cache_entry_t {
+      char      name[LONG_FILENAME_LENGTH];
+      bool      isDir;
+      uint16_t  date,
+                time;
+      uint32_t  size;
+    };
+
+    struct dir_cache_t {
+      uint32_t  cluster,        // First cluster of the folder
+                stamp,          // dir_cache_changes when loaded, 0 = empty
+                used;           // Last use, for slot replacement
+      uint16_t  count,          // Items in the folder
+                cached;         // Items held in entry[]
+      uint8_t   order[SD_DIR_CACHE_LIMIT];
+      dir_cache_entry_t entry[SD_DIR_CACHE_LIMIT];
+    };
+  #endif
+
   class CardReader {
 
     public: /** Constructor */
@@ -78,9 +106,22 @@
             cardOK,
             filenameIsDir;
 
+      #if HAS_SD_PACKED_GCODE
+        bool  packed_file,        // The open file starts with the ";PACKED 1" header
+              packed_line_start;  // The next byte read starts a line
+      #endif
+
       uint32_t  fileSize,
                 sdpos;
 
+      #if HAS_SD_IO_STATS
+        uint32_t  stats_start_sdpos,        // File position at the start of the print
+                  stats_queue_empty_count;  // Times the command queue ran dry while printing
+        millis_l  stats_queue_empty_ms,     // Total time the command queue was empty while printing
+                  stats_queue_empty_start;
+        bool      stats_queue_empty;
+      #endif
+
       float objectHeight,
             firstlayerHeight,
             layerHeight,
@@ -140,7 +181,7 @@
         #endif
 
         // Cache filenames to speed up SD menus.
-        #if ENABLED(SDSORT_USES_RAM)
+        #if ENABLED(SDSORT_USES_RAM) && !HAS_SD_DIR_CACHE
 
           // If using dynamic ram for names, allocate on the heap.
           #if ENABLED(SDSORT_CACHE_NAMES)
@@ -166,6 +207,12 @@
 
       #endif // SDCARD_SORT_ALPHA
 
+      #if HAS_SD_DIR_CACHE
+        dir_cache_t dir_cache[SD_DIR_CACHE_SLOTS],
+                   *dir_cache_current;
+        uint32_t    dir_cache_uses,
+                    dir_cache_changes;
+      #endif
 
 
     public: /** Public Function */
@@ -201,13 +248,34 @@
       uint16_t getnrfilenames();
       uint16_t get_num_Files();
 
+      #if HAS_SD_PACKED_GCODE
+        uint8_t unpack_line(const uint8_t code, char* buf);
+      #endif
+
+      #if HAS_FILE_TRANSFER
+        bool startBinaryWrite(char* filename, const uint32_t size);
+        void abortBinaryWrite();
+      #endif
+
       #if HAS_SD_RESTART
-        void open_restart_file(const bool read);
-        void close_restart_file();
-        void delete_restart_file();
-        bool exist_restart_file();
-        int16_t save_restart_data();
-        int16_t read_restart_data();
+        bool open_restart_journal(uint32_t &first_block, bool &created);
+      #endif
+
+      #if HAS_SD_IO_STATS
+        void reset_io_stats();
+        void print_io_stats();
+
+        // Called on every pass of the command loop, with the queue state while printing
+        FORCE_INLINE void check_queue_empty(const bool empty) {
+          if (empty == stats_queue_empty) return;
+          stats_queue_empty = empty;
+          if (empty) {
+            stats_queue_empty_start = millis();
+            stats_queue_empty_count++;
+          }
+          else
+            stats_queue_empty_ms += millis() - stats_queue_empty_start;
+        }
       #endif
 
       #if HAS_EEPROM_SD
@@ -235,14 +303,25 @@
         void presort();
         void getfilename_sorted(const uint16_t nr);
         #if ENABLED(SDSORT_GCODE)
-          FORCE_INLINE void setSortOn(bool b) { sort_alpha = b; presort(); }
-          FORCE_INLINE void setSortFolders(int i) { sort_folders = i; presort(); }
+          #if HAS_SD_DIR_CACHE
+            FORCE_INLINE void setSortOn(bool b) { sort_alpha = b; dir_cache_flush(); presort(); }
+            FORCE_INLINE void setSortFolders(int i) { sort_folders = i; dir_cache_flush(); presort(); }
+          #else
+            FORCE_INLINE void setSortOn(bool b) { sort_alpha = b; presort(); }
+            FORCE_INLINE void setSortFolders(int i) { sort_folders = i; presort(); }
+          #endif
           //FORCE_INLINE void setSortReverse(bool b) { sort_reverse = b; }
         #endif
       #endif
 
       FORCE_INLINE void pauseSDPrint() { sdprinting = false; }
-      FORCE_INLINE void setIndex(uint32_t newpos) { sdpos = newpos; gcode_file.seekSet(sdpos); }
+      FORCE_INLINE void setIndex(uint32_t newpos) {
+        sdpos = newpos;
+        gcode_file.seekSet(sdpos);
+        #if HAS_SD_PACKED_GCODE
+          packed_line_start = true;
+        #endif
+      }
       FORCE_INLINE uint32_t getIndex() { return sdpos; }
       FORCE_INLINE bool isFileOpen() { return gcode_file.isOpen(); }
       FORCE_INLINE bool eof() { return sdpos >= fileSize; }
@@ -255,6 +334,7 @@
     private: /** Private Function */
 
       void lsDive(SdBaseFile parent, const char* const match = NULL);
+      bool lsVisible(const dir_t* p);
       void parsejson(SdBaseFile &parser_file);
       void readFileInfo(SdBaseFile &file);
       void clearFileInfo();
@@ -269,6 +349,13 @@
         void flush_presort();
       #endif
 
+      #if HAS_SD_DIR_CACHE
+        bool dir_cache_select();
+        void dir_cache_load(dir_cache_t &slot);
+        void dir_cache_sort(dir_cache_t &slot);
+        void dir_cache_flush();
+      #endif
+
   };
 
   extern CardReader card;
@@ -0,0 +1,301 @@
+/**
+ * MK4duo Firmware for 3D Printer, Laser and CNC
+ *
+ * Based on Marlin, Sprinter and grbl
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ * Copyright (C) 2013 Alberto Cotronei @MagoKimbra
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../MK4duo.h"
+
+#if HAS_FILE_TRANSFER
+
+  #define FT_SYNC_1 0xAA
+  #define FT_SYNC_2 0x55
+
+  // Line quiet this long with acks on hold: the host waits, nothing is in flight
+  #define FT_HOLD_IDLE_MS 50
+
+  FileTransfer filetransfer;
+
+  bool      FileTransfer::active          = false,
+            FileTransfer::resend_pending  = false,
+            FileTransfer::contiguous      = false;
+
+  FileTransfer::FrameStateEnum FileTransfer::state = FT_SYNC1;
+
+  uint8_t   FileTransfer::header[4],
+            FileTransfer::crc_bytes[2],
+            FileTransfer::expected_seq    = 0,
+            FileTransfer::held            = 0;
+
+  uint16_t  FileTransfer::frame_index     = 0,
+            FileTransfer::frame_length    = 0,
+            FileTransfer::frame_crc       = 0,
+            FileTransfer::buffer_index    = 0;
+
+  uint32_t  FileTransfer::file_size       = 0,
+            FileTransfer::received        = 0,
+            FileTransfer::block_next      = 0,
+            FileTransfer::block_end       = 0;
+
+  watch_t   FileTransfer::timeout_watch;
+
+  uint8_t   FileTransfer::buffer[FILE_TRANSFER_BUFFER_SIZE + 512];
+
+  /**
+   * Public Function
+   */
+  void FileTransfer::start(char* filename, const uint32_t size) {
+
+    if (!card.cardOK) {
+      SERIAL_EM("ft:error no SD card");
+      return;
+    }
+
+    if (!card.startBinaryWrite(filename, size)) {
+      SERIAL_LMT(ER, MSG_SD_OPEN_FILE_FAIL, filename);
+      SERIAL_EM("ft:error open failed");
+      return;
+    }
+
+    // Raw block writes only when all the clusters are one after the other
+    contiguous      = size && card.gcode_file.contiguousRange(&block_next, &block_end);
+    file_size       = size;
+    received        = 0;
+    buffer_index    = 0;
+    expected_seq    = 0;
+    held            = 0;
+    resend_pending  = false;
+    state           = FT_SYNC1;
+    active          = true;
+    timeout_watch.start();
+
+    SERIAL_EMT(MSG_SD_WRITE_TO_FILE, filename);
+    SERIAL_MV("ft:ready P", FILE_TRANSFER_PACKET_SIZE);
+    SERIAL_EMV(" W", FILE_TRANSFER_WINDOW);
+  }
+
+  /**
+   * Read the frames from the serial, called in place of the line reader
+   */
+  void FileTransfer::receive() {
+
+    while (active && HAL::serialByteAvailable()) {
+
+      const int c = MKSERIAL.read();
+      if (c < 0) break;
+
+      const uint8_t b = c;
+      timeout_watch.start();
+      printer.max_inactivity_watch.start();
+
+      switch (state) {
+
+        case FT_SYNC1:
+          if (b == FT_SYNC_1) state = FT_SYNC2;
+          break;
+
+        case FT_SYNC2:
+          if (b == FT_SYNC_2) {
+            state = FT_HEADER;
+            frame_index = 0;
+            frame_crc = 0xFFFF;
+          }
+          else if (b != FT_SYNC_1)
+            state = FT_SYNC1;
+          break;
+
+        case FT_HEADER:
+          header[frame_index++] = b;
+          frame_crc = crc16(frame_crc, b);
+          if (frame_index == sizeof(header)) {
+            frame_index = 0;
+            frame_length = header[2] | (header[3] << 8);
+            if (frame_length > FILE_TRANSFER_PACKET_SIZE) {
+              state = FT_SYNC1;
+              request_resend();
+            }
+            else
+              state = frame_length ? FT_PAYLOAD : FT_CRC;
+          }
+          break;
+
+        case FT_PAYLOAD:
+          // Straight into the write buffer, it is kept only if the frame is good
+          buffer[buffer_index + frame_index++] = b;
+          frame_crc = crc16(frame_crc, b);
+          if (frame_index == frame_length) {
+            frame_index = 0;
+            state = FT_CRC;
+          }
+          break;
+
+        case FT_CRC:
+          crc_bytes[frame_index++] = b;
+          if (frame_index == sizeof(crc_bytes)) {
+            state = FT_SYNC1;
+            if (frame_crc == (crc_bytes[0] | (crc_bytes[1] << 8)))
+              process_frame();
+            else
+              request_resend();
+          }
+          break;
+      }
+    }
+
+    // The host stopped short of the window, at the end of the file or on its own
+    if (active && held && timeout_watch.elapsed(FT_HOLD_IDLE_MS)) {
+      if (flush_held()) timeout_watch.start();
+    }
+
+    if (active && timeout_watch.elapsed(FILE_TRANSFER_TIMEOUT * 1000UL))
+      fail(PSTR("timeout"));
+
+  }
+
+  /**
+   * Private Function
+   */
+  void FileTransfer::process_frame() {
+
+    const uint8_t type  = header[0],
+                  seq   = header[1];
+
+    if (seq != expected_seq) {
+      // A frame already stored, sent again because its ack got lost.
+      // With acks on hold the flush answers it, an ack now would open the window.
+      if (held) return;
+      if (uint8_t(expected_seq - seq) <= FILE_TRANSFER_WINDOW)
+        SERIAL_EMV("ft:ack ", int(uint8_t(expected_seq - 1)));
+      else
+        request_resend();
+      return;
+    }
+
+    resend_pending = false;
+
+    switch (type) {
+
+      case FT_DATA:
+        if (file_size && received + frame_length > file_size) {
+          fail(PSTR("file larger than announced"));
+          return;
+        }
+        received += frame_length;
+        buffer_index += frame_length;
+        expected_seq++;
+        // The RX ring of the serial is far smaller than a window, so the SD is never
+        // written with frames in flight: once a full window could reach the end of
+        // the buffer the acks are held, the host stops when its window is used up
+        // and the buffer is written before the ack that lets it go on.
+        if (held || buffer_index + FILE_TRANSFER_WINDOW * FILE_TRANSFER_PACKET_SIZE > FILE_TRANSFER_BUFFER_SIZE) {
+          if (++held >= FILE_TRANSFER_WINDOW) (void)flush_held();
+        }
+        else
+          SERIAL_EMV("ft:ack ", int(seq));
+        break;
+
+      case FT_END:
+        finish();
+        break;
+
+      case FT_ABORT:
+        fail(PSTR("aborted by host"));
+        break;
+
+      default:
+        fail(PSTR("unknown frame"));
+        break;
+    }
+
+  }
+
+  void FileTransfer::request_resend() {
+    // One request per error, the host goes back to the first unacked frame
+    if (resend_pending) return;
+    resend_pending = true;
+    SERIAL_EMV("ft:rs ", int(expected_seq));
+  }
+
+  bool FileTransfer::flush_held() {
+    // Whole blocks only, the rest stays at the start of the buffer
+    const uint16_t count = buffer_index & ~511;
+    if (!write_buffer(count)) {
+      fail(PSTR("SD write failed"));
+      return false;
+    }
+    buffer_index -= count;
+    memmove(buffer, buffer + count, buffer_index);
+    held = 0;
+    SERIAL_EMV("ft:ack ", int(uint8_t(expected_seq - 1)));
+    return true;
+  }
+
+  bool FileTransfer::write_buffer(const uint16_t count) {
+
+    if (!count) return true;
+
+    if (!contiguous) return card.gcode_file.write(buffer, count) == int(count);
+
+    // Pad the last block, truncate() gives the file its real size at the end
+    const uint16_t blocks = (count + 511) >> 9;
+    memset(buffer + count, 0, (blocks << 9) - count);
+
+    if (block_next + blocks - 1 > block_end) return false;
+
+    Sd2Card &sd = card.getSd2Card();
+    if (!sd.writeStart(block_next, blocks)) return false;
+    for (uint16_t b = 0; b < blocks; b++)
+      if (!sd.writeData(buffer + (b << 9))) return false;
+    if (!sd.writeStop()) return false;
+
+    block_next += blocks;
+    return true;
+  }
+
+  void FileTransfer::finish() {
+
+    if (!write_buffer(buffer_index) || (contiguous && !card.gcode_file.truncate(received))) {
+      fail(PSTR("SD write failed"));
+      return;
+    }
+
+    active = false;
+    card.finishWrite();
+    SERIAL_EMV("ft:done ", received);
+  }
+
+  void FileTransfer::fail(PGM_P const reason) {
+    active = false;
+    card.abortBinaryWrite();
+    SERIAL_MSG("ft:error ");
+    SERIAL_PS(reason);
+    SERIAL_EOL();
+  }
+
+  // CRC-16/CCITT, polynomial 0x1021
+  uint16_t FileTransfer::crc16(uint16_t crc, const uint8_t data) {
+    crc = (uint8_t)(crc >> 8) | (crc << 8);
+    crc ^= data;
+    crc ^= (uint8_t)(crc & 0xFF) >> 4;
+    crc ^= crc << 12;
+    crc ^= (crc & 0xFF) << 5;
+    return crc;
+  }
+
+#endif // HAS_FILE_TRANSFER
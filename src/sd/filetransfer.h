@@ -0,0 +1,120 @@
+/**
+ * MK4duo Firmware for 3D Printer, Laser and CNC
+ *
+ * Based on Marlin, Sprinter and grbl
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ * Copyright (C) 2013 Alberto Cotronei @MagoKimbra
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * filetransfer.h - Binary upload of files to the SD card
+ *
+ * M28 B1 [S<bytes>] <filename> opens the file and answers "ft:ready P<packet> W<window>"
+ * followed by "ok". From then on the serial input is read as frames, until the transfer
+ * ends or fails:
+ *
+ *   0xAA 0x55 | type | seq | length (2 bytes, LSB first) | payload | CRC (2 bytes, LSB first)
+ *
+ *   type    0 = data, 1 = end of file, 2 = abort
+ *   seq     frame number, starting from 0 and wrapping at 255
+ *   length  payload bytes, up to FILE_TRANSFER_PACKET_SIZE (0 for end and abort)
+ *   CRC     CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF) of type, seq, length and payload
+ *
+ * Replies are text lines, other firmware messages may come in between:
+ *
+ *   ft:ack <seq>      frame <seq> and all previous ones are stored
+ *   ft:rs <seq>       frame lost or damaged, send again starting from <seq>
+ *   ft:done <bytes>   file closed after the end frame
+ *   ft:error <text>   transfer aborted, the file is removed
+ *
+ * The host may send up to FILE_TRANSFER_WINDOW frames ahead of the last ack, and
+ * sends again from the first unacked frame when no ack comes for a while.
+ * When a full window could reach the end of FILE_TRANSFER_BUFFER_SIZE the acks are
+ * held: the host stops once its window is used up (or goes quiet at the end of the
+ * file), the buffered blocks are written to the SD with nothing in flight and one
+ * ack releases the whole window. With S<bytes> the clusters are allocated in
+ * advance and written with raw multi-block writes.
+ */
+
+#ifndef _FILETRANSFER_H_
+#define _FILETRANSFER_H_
+
+#if HAS_FILE_TRANSFER
+
+  class FileTransfer {
+
+    public: /** Constructor */
+
+      FileTransfer() {}
+
+    public: /** Public Parameters */
+
+      static bool active;
+
+    private: /** Private Parameters */
+
+      enum FrameStateEnum : uint8_t { FT_SYNC1, FT_SYNC2, FT_HEADER, FT_PAYLOAD, FT_CRC };
+      enum FrameTypeEnum  : uint8_t { FT_DATA, FT_END, FT_ABORT };
+
+      static FrameStateEnum state;
+
+      static uint8_t  header[4],
+                      crc_bytes[2],
+                      expected_seq,
+                      held;
+
+      static bool     resend_pending,
+                      contiguous;
+
+      static uint16_t frame_index,
+                      frame_length,
+                      frame_crc,
+                      buffer_index;
+
+      static uint32_t file_size,
+                      received,
+                      block_next,
+                      block_end;
+
+      static watch_t  timeout_watch;
+
+      // Room for a full buffer and the padding of the last block
+      static uint8_t  buffer[FILE_TRANSFER_BUFFER_SIZE + 512];
+
+    public: /** Public Function */
+
+      static void start(char* filename, const uint32_t size);
+      static void receive();
+
+    private: /** Private Function */
+
+      static void process_frame();
+      static void request_resend();
+      static bool flush_held();
+      static bool write_buffer(const uint16_t count);
+      static void finish();
+      static void fail(PGM_P const reason);
+
+      static uint16_t crc16(uint16_t crc, const uint8_t data);
+
+  };
+
+  extern FileTransfer filetransfer;
+
+#endif // HAS_FILE_TRANSFER
+
+#endif /* _FILETRANSFER_H_ */
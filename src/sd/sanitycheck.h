@@ -52,6 +52,45 @@
   #if ENABLED(SD_SETTINGS) && DISABLED(SD_CFG_SECONDS)
     #error "DEPENDENCY ERROR: Missing setting SD_CFG_SECONDS."
   #endif
+  #if ENABLED(SD_RESTART_FILE)
+    #if DISABLED(SD_RESTART_FILE_SAVE_TIME)
+      #error "DEPENDENCY ERROR: Missing setting SD_RESTART_FILE_SAVE_TIME."
+    #elif DISABLED(SD_RESTART_JOURNAL_BLOCKS)
+      #error "DEPENDENCY ERROR: Missing setting SD_RESTART_JOURNAL_BLOCKS."
+    #elif SD_RESTART_JOURNAL_BLOCKS < 2 || SD_RESTART_JOURNAL_BLOCKS > 1024
+      #error "SD_RESTART_JOURNAL_BLOCKS must be between 2 and 1024."
+    #endif
+  #endif
+  #if ENABLED(SD_DIR_CACHE)
+    #if DISABLED(SD_DIR_CACHE_SLOTS)
+      #error "DEPENDENCY ERROR: Missing setting SD_DIR_CACHE_SLOTS."
+    #elif DISABLED(SD_DIR_CACHE_LIMIT)
+      #error "DEPENDENCY ERROR: Missing setting SD_DIR_CACHE_LIMIT."
+    #elif SD_DIR_CACHE_SLOTS < 1
+      #error "SD_DIR_CACHE_SLOTS must be at least 1."
+    #elif SD_DIR_CACHE_LIMIT < 10 || SD_DIR_CACHE_LIMIT > 256
+      #error "SD_DIR_CACHE_LIMIT must be between 10 and 256."
+    #endif
+  #endif
+  #if ENABLED(BINARY_FILE_TRANSFER)
+    #if DISABLED(FILE_TRANSFER_PACKET_SIZE)
+      #error "DEPENDENCY ERROR: Missing setting FILE_TRANSFER_PACKET_SIZE."
+    #elif DISABLED(FILE_TRANSFER_BUFFER_SIZE)
+      #error "DEPENDENCY ERROR: Missing setting FILE_TRANSFER_BUFFER_SIZE."
+    #elif DISABLED(FILE_TRANSFER_WINDOW)
+      #error "DEPENDENCY ERROR: Missing setting FILE_TRANSFER_WINDOW."
+    #elif DISABLED(FILE_TRANSFER_TIMEOUT)
+      #error "DEPENDENCY ERROR: Missing setting FILE_TRANSFER_TIMEOUT."
+    #elif FILE_TRANSFER_PACKET_SIZE < 64 || FILE_TRANSFER_PACKET_SIZE > 1024
+      #error "FILE_TRANSFER_PACKET_SIZE must be between 64 and 1024."
+    #elif FILE_TRANSFER_BUFFER_SIZE < 512 || FILE_TRANSFER_BUFFER_SIZE % 512
+      #error "FILE_TRANSFER_BUFFER_SIZE must be a multiple of 512."
+    #elif FILE_TRANSFER_WINDOW < 1 || FILE_TRANSFER_WINDOW > 16
+      #error "FILE_TRANSFER_WINDOW must be between 1 and 16."
+    #elif FILE_TRANSFER_WINDOW * FILE_TRANSFER_PACKET_SIZE > FILE_TRANSFER_BUFFER_SIZE
+      #error "FILE_TRANSFER_WINDOW * FILE_TRANSFER_PACKET_SIZE must fit in FILE_TRANSFER_BUFFER_SIZE, the serial RX ring cannot hold a window."
+    #endif
+  #endif
 #endif
 
 #endif /* _SD_CARD_SANITYCHECK_H_ */